@@ -0,0 +1,85 @@
+#include "alloc_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<size_t> allocation_count{0};
+
+void* CountedAllocate(size_t size, size_t alignment) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (size == 0) {
+    size = 1;
+  }
+  void* p = nullptr;
+  if (alignment <= alignof(std::max_align_t)) {
+    p = std::malloc(size);
+  } else {
+    size = (size + alignment - 1) / alignment * alignment;
+    p = std::aligned_alloc(alignment, size);
+  }
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+}  // namespace
+
+namespace bench {
+
+size_t AllocationCount() {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+}  // namespace bench
+
+void* operator new(size_t size) {
+  return CountedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](size_t size) {
+  return CountedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+  return CountedAllocate(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+  return CountedAllocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
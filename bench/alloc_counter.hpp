@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+
+namespace bench {
+
+// Number of global operator new calls made by the benchmark binary so far.
+size_t AllocationCount();
+
+}  // namespace bench
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "collision.hpp"
+#include "rectangle.hpp"
+
+using namespace geometry;
+
+namespace {
+
+// Randomly rotated rectangles; the extent grows with the count so every scene has the same
+// density (about two overlaps per figure).
+FigureArray<Rectangle<double>> MakeScene(size_t count) {
+  std::mt19937 rng(13);
+  double extent = std::sqrt(static_cast<double>(count)) * 4.0;
+  std::uniform_real_distribution<double> position(0.0, extent);
+  std::uniform_real_distribution<double> size(0.5, 3.0);
+  std::uniform_real_distribution<double> angle(0.0, std::numbers::pi);
+  FigureArray<Rectangle<double>> figures;
+  figures.Reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    Rectangle<double> rectangle(Point<double>(0.0, 0.0), Point<double>(1.0, 0.0),
+                                Point<double>(1.0, 1.0), Point<double>(0.0, 1.0));
+    double x = position(rng);
+    double y = position(rng);
+    rectangle.Transform(AffineTransform::Scaling(size(rng), size(rng))
+                            .Then(AffineTransform::Rotation(angle(rng)))
+                            .Then(AffineTransform::Translation(x, y)));
+    figures.PushBack(rectangle);
+  }
+  return figures;
+}
+
+void BM_AllPairsOverlaps(benchmark::State& state) {
+  FigureArray<Rectangle<double>> figures = MakeScene(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::vector<IndexPair> pairs;
+    for (size_t i = 0; i < figures.Size(); ++i) {
+      for (size_t j = i + 1; j < figures.Size(); ++j) {
+        if (Overlaps(figures[i], figures[j])) {
+          pairs.emplace_back(i, j);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(pairs);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SweepAndPrune(benchmark::State& state) {
+  FigureArray<Rectangle<double>> figures = MakeScene(static_cast<size_t>(state.range(0)));
+  size_t found = 0;
+  for (auto _ : state) {
+    std::vector<IndexPair> pairs = FindOverlaps(figures);
+    found = pairs.size();
+    benchmark::DoNotOptimize(pairs);
+  }
+  state.counters["pairs"] = static_cast<double>(found);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ParallelSweepAndPrune(benchmark::State& state) {
+  FigureArray<Rectangle<double>> figures = MakeScene(static_cast<size_t>(state.range(0)));
+  ThreadPool pool(static_cast<size_t>(state.range(1)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(FindOverlaps(figures, pool));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void ThreadArgs(benchmark::internal::Benchmark* b) {
+  int64_t max_threads = std::max<int64_t>(1, std::thread::hardware_concurrency());
+  for (int64_t size : {1 << 16, 1 << 20}) {
+    for (int64_t threads = 1; threads < max_threads; threads *= 2) {
+      b->Args({size, threads});
+    }
+    b->Args({size, max_threads});
+  }
+  b->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK(BM_AllPairsOverlaps)->Arg(1 << 12)->Arg(1 << 14)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SweepAndPrune)
+    ->Arg(1 << 12)
+    ->Arg(1 << 14)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParallelSweepAndPrune)->Apply(ThreadArgs)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "concurrent_figure_array.hpp"
+#include "rhombus.hpp"
+
+using namespace geometry;
+
+namespace {
+
+constexpr size_t TOTAL_FIGURES = 1 << 21;
+
+Rhombus<double> MakeRhombus(size_t i) {
+  double d = static_cast<double>(i % 100 + 1);
+  return Rhombus<double>(Point<double>(0.0, d), Point<double>(d, 0.0), Point<double>(0.0, -d),
+                         Point<double>(-d, 0.0));
+}
+
+template <typename Body>
+void RunProducers(size_t thread_count, Body body) {
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < thread_count; ++t) {
+    threads.emplace_back(body, t);
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+// Baseline: every producer appends to one FigureArray behind a mutex.
+void BM_MutexFigureArrayAppend(benchmark::State& state) {
+  size_t thread_count = static_cast<size_t>(state.range(0));
+  size_t per_thread = TOTAL_FIGURES / thread_count;
+  for (auto _ : state) {
+    FigureArray<Rhombus<double>> array;
+    std::mutex mutex;
+    RunProducers(thread_count, [&](size_t) {
+      for (size_t i = 0; i < per_thread; ++i) {
+        Rhombus<double> figure = MakeRhombus(i);
+        std::lock_guard<std::mutex> lock(mutex);
+        array.PushBack(figure);
+      }
+    });
+    benchmark::DoNotOptimize(array.Size());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * per_thread * thread_count));
+}
+
+void BM_ConcurrentAppend(benchmark::State& state) {
+  size_t thread_count = static_cast<size_t>(state.range(0));
+  size_t per_thread = TOTAL_FIGURES / thread_count;
+  for (auto _ : state) {
+    ConcurrentFigureArray<Rhombus<double>> array;
+    std::vector<ConcurrentFigureArray<Rhombus<double>>::Producer> producers;
+    for (size_t t = 0; t < thread_count; ++t) {
+      producers.push_back(array.CreateProducer());
+    }
+    RunProducers(thread_count, [&](size_t t) {
+      for (size_t i = 0; i < per_thread; ++i) {
+        producers[t].PushBack(MakeRhombus(i));
+      }
+    });
+    benchmark::DoNotOptimize(array.Size());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * per_thread * thread_count));
+}
+
+void BM_ConcurrentAppendAndMerge(benchmark::State& state) {
+  size_t thread_count = static_cast<size_t>(state.range(0));
+  size_t per_thread = TOTAL_FIGURES / thread_count;
+  for (auto _ : state) {
+    ConcurrentFigureArray<Rhombus<double>> array;
+    std::vector<ConcurrentFigureArray<Rhombus<double>>::Producer> producers;
+    for (size_t t = 0; t < thread_count; ++t) {
+      producers.push_back(array.CreateProducer());
+    }
+    RunProducers(thread_count, [&](size_t t) {
+      for (size_t i = 0; i < per_thread; ++i) {
+        producers[t].PushBack(MakeRhombus(i));
+      }
+    });
+    benchmark::DoNotOptimize(array.Merge().Size());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * per_thread * thread_count));
+}
+
+void ThreadArgs(benchmark::internal::Benchmark* b) {
+  int64_t max_threads = std::max<int64_t>(2, std::thread::hardware_concurrency());
+  for (int64_t threads = 1; threads < max_threads; threads *= 2) {
+    b->Arg(threads);
+  }
+  b->Arg(max_threads);
+  b->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+BENCHMARK(BM_MutexFigureArrayAppend)->Apply(ThreadArgs);
+BENCHMARK(BM_ConcurrentAppend)->Apply(ThreadArgs);
+BENCHMARK(BM_ConcurrentAppendAndMerge)->Apply(ThreadArgs);
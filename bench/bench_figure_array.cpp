@@ -0,0 +1,179 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <utility>
+
+#include "alloc_counter.hpp"
+#include "figure_vector.hpp"
+#include "rhombus.hpp"
+
+using namespace geometry;
+
+namespace {
+
+// Previous FigureArray growth: new T[] default-constructs every spare slot and elements
+// are moved over by assignment.
+template <typename T>
+class LegacyArray {
+ public:
+  void PushBack(T&& value) {
+    if (sz_ == capacity_) {
+      size_t new_capacity = capacity_ == 0 ? 4 : capacity_ * 2;
+      std::unique_ptr<T[]> new_data(new T[new_capacity]);
+      for (size_t i = 0; i < sz_; ++i) {
+        new_data[i] = std::move(data_[i]);
+      }
+      data_ = std::move(new_data);
+      capacity_ = new_capacity;
+    }
+    data_[sz_++] = std::move(value);
+  }
+
+ private:
+  size_t sz_ = 0;
+  size_t capacity_ = 0;
+  std::unique_ptr<T[]> data_;
+};
+
+Rhombus<double> MakeRhombus(size_t i) {
+  double d = static_cast<double>(i % 100 + 1);
+  return Rhombus<double>(Point<double>(0.0, d), Point<double>(d, 0.0), Point<double>(0.0, -d),
+                         Point<double>(-d, 0.0));
+}
+
+template <typename Array>
+void BM_PushBack(benchmark::State& state) {
+  size_t count = static_cast<size_t>(state.range(0));
+  size_t allocations = 0;
+  for (auto _ : state) {
+    size_t before = bench::AllocationCount();
+    Array arr;
+    for (size_t i = 0; i < count; ++i) {
+      arr.PushBack(MakeRhombus(i));
+    }
+    allocations += bench::AllocationCount() - before;
+    benchmark::DoNotOptimize(arr);
+  }
+  state.counters["allocs_per_iter"] =
+      benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_EmplaceBack(benchmark::State& state) {
+  size_t count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    FigureArray<Rhombus<double>> arr;
+    for (size_t i = 0; i < count; ++i) {
+      double d = static_cast<double>(i % 100 + 1);
+      arr.EmplaceBack(Point<double>(0.0, d), Point<double>(d, 0.0), Point<double>(0.0, -d),
+                      Point<double>(-d, 0.0));
+    }
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_InsertFront(benchmark::State& state) {
+  size_t count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    FigureArray<Rhombus<double>> arr;
+    for (size_t i = 0; i < count; ++i) {
+      arr.Insert(0, MakeRhombus(i));
+    }
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+FigureArray<Rhombus<double>> MakeRhombi(size_t count) {
+  FigureArray<Rhombus<double>> arr;
+  arr.Reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    arr.PushBack(MakeRhombus(i));
+  }
+  return arr;
+}
+
+// Retention pass that drops every third figure.
+bool IsExpired(const Rhombus<double>& r) {
+  return static_cast<size_t>(r.GetVertex(0).y) % 3 == 0;
+}
+
+void BM_EraseLoop(benchmark::State& state) {
+  size_t count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Rhombus<double>> arr = MakeRhombi(count);
+    state.ResumeTiming();
+    for (size_t i = arr.Size(); i-- > 0;) {
+      if (IsExpired(arr[i])) {
+        arr.Erase(i);
+      }
+    }
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_EraseIf(benchmark::State& state) {
+  size_t count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Rhombus<double>> arr = MakeRhombi(count);
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(arr.EraseIf(IsExpired));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_EraseIfParallel(benchmark::State& state) {
+  size_t count = static_cast<size_t>(state.range(0));
+  ThreadPool pool;
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Rhombus<double>> arr = MakeRhombi(count);
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(arr.EraseIf(IsExpired, pool));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_AppendLoop(benchmark::State& state) {
+  size_t count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Rhombus<double>> arr = MakeRhombi(count);
+    FigureArray<Rhombus<double>> batch = MakeRhombi(count);
+    state.ResumeTiming();
+    for (size_t i = 0; i < batch.Size(); ++i) {
+      arr.PushBack(std::move(batch[i]));
+    }
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Append(benchmark::State& state) {
+  size_t count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Rhombus<double>> arr = MakeRhombi(count);
+    FigureArray<Rhombus<double>> batch = MakeRhombi(count);
+    state.ResumeTiming();
+    arr.Append(std::move(batch));
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PushBack, LegacyArray<Rhombus<double>>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PushBack, FigureArray<Rhombus<double>>)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_EmplaceBack)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_InsertFront)->Range(1 << 8, 1 << 14);
+BENCHMARK(BM_EraseLoop)->Range(1 << 10, 1 << 14);
+BENCHMARK(BM_EraseIf)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_EraseIfParallel)->Range(1 << 14, 1 << 20);
+BENCHMARK(BM_AppendLoop)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_Append)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "figure_batch.hpp"
+
+using namespace geometry;
+
+namespace {
+
+template <template <typename> class Shape>
+FigureArray<Shape<double>> MakeFigures(size_t count) {
+  FigureArray<Shape<double>> figures;
+  figures.Reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    double d = static_cast<double>(i % 100 + 1);
+    figures.PushBack(Shape<double>(Point<double>(0.0, d), Point<double>(d, 0.0),
+                                   Point<double>(0.0, -d), Point<double>(-d, 0.0)));
+  }
+  return figures;
+}
+
+template <template <typename> class Shape>
+void BM_ArrayTotalArea(benchmark::State& state) {
+  FigureArray<Shape<double>> figures = MakeFigures<Shape>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(figures.GetTotalArea());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <template <typename> class Shape>
+void BM_BatchTotalArea(benchmark::State& state) {
+  FigureBatch<double, Shape> batch(MakeFigures<Shape>(static_cast<size_t>(state.range(0))));
+  SimdLevel saved = GetSimdLevel();
+  SetSimdLevel(static_cast<SimdLevel>(state.range(1)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(batch.GetTotalArea());
+  }
+  SetSimdLevel(saved);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <template <typename> class Shape>
+void BM_BatchCenters(benchmark::State& state) {
+  FigureBatch<double, Shape> batch(MakeFigures<Shape>(static_cast<size_t>(state.range(0))));
+  std::vector<double> center_x(batch.Size());
+  std::vector<double> center_y(batch.Size());
+  SimdLevel saved = GetSimdLevel();
+  SetSimdLevel(static_cast<SimdLevel>(state.range(1)));
+  for (auto _ : state) {
+    batch.ComputeCenters(center_x.data(), center_y.data());
+    benchmark::ClobberMemory();
+  }
+  SetSimdLevel(saved);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void SimdArgs(benchmark::internal::Benchmark* b) {
+  for (int64_t size : {1 << 16, 1 << 20}) {
+    for (int64_t level : {0, 1, 2}) {
+      b->Args({size, level});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ArrayTotalArea, Rhombus)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_ArrayTotalArea, Rectangle)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_ArrayTotalArea, Trapezoid)->Arg(1 << 16)->Arg(1 << 20);
+
+BENCHMARK_TEMPLATE(BM_BatchTotalArea, Rhombus)->Apply(SimdArgs);
+BENCHMARK_TEMPLATE(BM_BatchTotalArea, Rectangle)->Apply(SimdArgs);
+BENCHMARK_TEMPLATE(BM_BatchTotalArea, Trapezoid)->Apply(SimdArgs);
+
+BENCHMARK_TEMPLATE(BM_BatchCenters, Rhombus)->Apply(SimdArgs);
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "figure_collection.hpp"
+
+using namespace geometry;
+
+namespace {
+
+template <typename Sink>
+void BuildScene(size_t count, Sink&& sink) {
+  for (size_t i = 0; i < count; ++i) {
+    double d = static_cast<double>(i % 100 + 1);
+    Point<double> a(0.0, 0.0);
+    Point<double> b(2 * d, 0.0);
+    Point<double> c(d + 1, d);
+    Point<double> e(1.0, d);
+    switch (i % 3) {
+      case 0:
+        sink(Rectangle<double>(a, b, Point<double>(2 * d, d), Point<double>(0.0, d)));
+        break;
+      case 1:
+        sink(Rhombus<double>(Point<double>(0.0, d), Point<double>(d, 0.0),
+                             Point<double>(0.0, -d), Point<double>(-d, 0.0)));
+        break;
+      default:
+        sink(Trapezoid<double>(a, b, c, e));
+        break;
+    }
+  }
+}
+
+std::vector<std::shared_ptr<Figure<double>>> MakeSharedScene(size_t count) {
+  std::vector<std::shared_ptr<Figure<double>>> scene;
+  scene.reserve(count);
+  BuildScene(count, [&](auto&& figure) {
+    using Shape = std::remove_cvref_t<decltype(figure)>;
+    scene.push_back(std::make_shared<Shape>(figure));
+  });
+  return scene;
+}
+
+FigureCollection<double> MakeCollection(size_t count) {
+  FigureCollection<double> scene;
+  BuildScene(count, [&](auto&& figure) { scene.PushBack(figure); });
+  return scene;
+}
+
+void BM_SharedPtrTotalArea(benchmark::State& state) {
+  auto scene = MakeSharedScene(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    double total = 0.0;
+    for (const auto& figure : scene) {
+      total += static_cast<double>(*figure);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CollectionTotalArea(benchmark::State& state) {
+  FigureCollection<double> scene = MakeCollection(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(scene.GetTotalArea());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SharedPtrCenters(benchmark::State& state) {
+  auto scene = MakeSharedScene(static_cast<size_t>(state.range(0)));
+  std::vector<Point<double>> centers(scene.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < scene.size(); ++i) {
+      centers[i] = scene[i]->GetCenter();
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CollectionCenters(benchmark::State& state) {
+  FigureCollection<double> scene = MakeCollection(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(scene.ComputeCenters());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_SharedPtrTotalArea)->Range(1 << 12, 1 << 20);
+BENCHMARK(BM_CollectionTotalArea)->Range(1 << 12, 1 << 20);
+BENCHMARK(BM_SharedPtrCenters)->Range(1 << 12, 1 << 20);
+BENCHMARK(BM_CollectionCenters)->Range(1 << 12, 1 << 20);
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "figure_file.hpp"
+#include "figure_parser.hpp"
+
+using namespace geometry;
+
+namespace {
+
+FigureArray<Trapezoid<double>> MakeFigures(size_t count) {
+  FigureArray<Trapezoid<double>> figures;
+  figures.Reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    double d = static_cast<double>(i % 100 + 1);
+    figures.PushBack(Trapezoid<double>(Point<double>(0.0, 0.0), Point<double>(2 * d, 0.0),
+                                       Point<double>(d + 1.5, d), Point<double>(0.5, d)));
+  }
+  return figures;
+}
+
+// Text round trip: what persisting a FigureArray costs without the binary format.
+void BM_TextLoadTotalArea(benchmark::State& state) {
+  FigureArray<Trapezoid<double>> source = MakeFigures(static_cast<size_t>(state.range(0)));
+  std::ostringstream out;
+  for (size_t i = 0; i < source.Size(); ++i) {
+    for (size_t k = 0; k < source[i].GetVertexCount(); ++k) {
+      out << source[i].GetVertex(k).x << ' ' << source[i].GetVertex(k).y << ' ';
+    }
+    out << '\n';
+  }
+  std::string text = out.str();
+  for (auto _ : state) {
+    FigureArray<Trapezoid<double>> figures;
+    LoadFigures(text, figures);
+    benchmark::DoNotOptimize(figures.GetTotalArea());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_MappedOpenTotalArea(benchmark::State& state) {
+  std::string path = "bench_figure_file.bin";
+  WriteFigureFile(path, MakeFigures(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    MappedFigureView<double, Trapezoid> view(path);
+    benchmark::DoNotOptimize(view.GetTotalArea());
+  }
+  std::remove(path.c_str());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_MappedOpen(benchmark::State& state) {
+  std::string path = "bench_figure_file.bin";
+  WriteFigureFile(path, MakeFigures(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    MappedFigureView<double, Trapezoid> view(path);
+    benchmark::DoNotOptimize(view.Size());
+  }
+  std::remove(path.c_str());
+}
+
+}  // namespace
+
+BENCHMARK(BM_TextLoadTotalArea)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_MappedOpenTotalArea)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_MappedOpen)->Range(1 << 10, 1 << 20);
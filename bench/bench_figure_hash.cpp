@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "figure_hash.hpp"
+#include "figure_vector.hpp"
+#include "thread_pool.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+namespace {
+
+// A quarter of the figures are distinct; the rest repeat one of them, sometimes listed
+// from another vertex.
+FigureArray<Trapezoid<double>> MakeFigures(size_t count) {
+  size_t distinct = count / 4 + 1;
+  FigureArray<Trapezoid<double>> arr;
+  arr.Reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    size_t k = (i * 2654435761u) % distinct;
+    double x = static_cast<double>(k % 1000) * 10.0;
+    double y = static_cast<double>(k / 1000) * 0.5;
+    Point<double> v[4] = {{x, y}, {x + 6.0, y}, {x + 4.0, y + 2.0}, {x + 1.0, y + 2.0}};
+    size_t s = i % 4;
+    arr.PushBack(Trapezoid<double>(v[s], v[(s + 1) % 4], v[(s + 2) % 4], v[(s + 3) % 4]));
+  }
+  return arr;
+}
+
+// Previous approach: every figure is compared with operator== (in all four rotations)
+// against each figure kept so far.
+size_t DeduplicatePairwise(FigureArray<Trapezoid<double>>& arr) {
+  std::vector<size_t> kept;
+  std::vector<uint8_t> duplicate(arr.Size(), 0);
+  const FigureArray<Trapezoid<double>>& figures = arr;
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    const Trapezoid<double>& figure = figures[i];
+    for (size_t j : kept) {
+      const Trapezoid<double>& other = figures[j];
+      for (size_t s = 0; s < 4 && !duplicate[i]; ++s) {
+        Trapezoid<double> rotated(other.GetVertex(s), other.GetVertex((s + 1) % 4),
+                                  other.GetVertex((s + 2) % 4), other.GetVertex((s + 3) % 4));
+        duplicate[i] = figure == rotated;
+      }
+      if (duplicate[i]) {
+        break;
+      }
+    }
+    if (!duplicate[i]) {
+      kept.push_back(i);
+    }
+  }
+  return arr.EraseIf(
+      [&](const Trapezoid<double>& figure) { return duplicate[&figure - &figures[0]] != 0; });
+}
+
+void BM_DeduplicatePairwise(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Trapezoid<double>> arr = MakeFigures(static_cast<size_t>(state.range(0)));
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(DeduplicatePairwise(arr));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Deduplicate(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Trapezoid<double>> arr = MakeFigures(static_cast<size_t>(state.range(0)));
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(arr.Deduplicate());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_DeduplicateParallel(benchmark::State& state) {
+  ThreadPool pool;
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Trapezoid<double>> arr = MakeFigures(static_cast<size_t>(state.range(0)));
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(arr.Deduplicate(pool));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FigureHash(benchmark::State& state) {
+  FigureArray<Trapezoid<double>> arr = MakeFigures(static_cast<size_t>(state.range(0)));
+  const FigureArray<Trapezoid<double>>& figures = arr;
+  FigureHash<Trapezoid<double>> hash;
+  for (auto _ : state) {
+    size_t combined = 0;
+    for (size_t i = 0; i < figures.Size(); ++i) {
+      combined ^= hash(figures[i]);
+    }
+    benchmark::DoNotOptimize(combined);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_DeduplicatePairwise)->Range(1 << 8, 1 << 12)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Deduplicate)->Range(1 << 8, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DeduplicateParallel)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FigureHash)->Arg(1 << 16);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "figure_parser.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+namespace {
+
+template <Scalar T>
+std::string MakeText(size_t count) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> coordinate(-1e4, 1e4);
+  std::ostringstream out;
+  for (size_t i = 0; i < count; ++i) {
+    for (int k = 0; k < 8; ++k) {
+      out << static_cast<T>(coordinate(rng)) << (k == 7 ? '\n' : ' ');
+    }
+  }
+  return out.str();
+}
+
+template <Scalar T>
+void BM_StreamExtraction(benchmark::State& state) {
+  std::string text = MakeText<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    FigureArray<Trapezoid<T>> arr;
+    std::istringstream in(text);
+    Trapezoid<T> shape;
+    while (in >> shape) {
+      arr.PushBack(shape);
+    }
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+template <Scalar T>
+void BM_BulkLoader(benchmark::State& state) {
+  std::string text = MakeText<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    FigureArray<Trapezoid<T>> arr;
+    LoadFigures(text, arr);
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_StreamExtraction, int)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_BulkLoader, int)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_StreamExtraction, double)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_BulkLoader, double)->Arg(1 << 16)->Arg(1 << 20);
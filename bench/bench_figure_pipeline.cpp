@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "figure_pipeline.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+namespace {
+
+std::string MakeText(size_t count) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> coordinate(-1e4, 1e4);
+  std::ostringstream out;
+  for (size_t i = 0; i < count; ++i) {
+    for (int k = 0; k < 8; ++k) {
+      out << coordinate(rng) << (k == 7 ? '\n' : ' ');
+    }
+  }
+  return out.str();
+}
+
+const std::string& Text(size_t count) {
+  static std::string text;
+  static size_t text_count = 0;
+  if (text_count != count) {
+    text = MakeText(count);
+    text_count = count;
+  }
+  return text;
+}
+
+// Previous approach: load everything, then aggregate.
+void BM_MaterializeThenAggregate(benchmark::State& state) {
+  const std::string& text = Text(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    FigureArray<Trapezoid<double>> figures;
+    LoadFigures(text, figures);
+    double min_area = std::numeric_limits<double>::infinity();
+    double max_area = -min_area;
+    BoundingBox centers;
+    for (size_t i = 0; i < figures.Size(); ++i) {
+      double area = static_cast<double>(figures[i]);
+      min_area = std::min(min_area, area);
+      max_area = std::max(max_area, area);
+      Point<double> center = figures[i].GetCenter();
+      centers.Expand(center.x, center.y);
+    }
+    benchmark::DoNotOptimize(figures.GetTotalArea());
+    benchmark::DoNotOptimize(centers);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+void BM_Pipeline(benchmark::State& state) {
+  const std::string& text = Text(static_cast<size_t>(state.range(0)));
+  PipelineOptions options;
+  options.worker_count = static_cast<size_t>(state.range(1));
+  options.histogram_bins = 64;
+  options.histogram_max = 1e8;
+  FigurePipeline<Trapezoid<double>> pipeline(options);
+  for (auto _ : state) {
+    AreaStatistics stats = pipeline.Run(std::string_view(text));
+    benchmark::DoNotOptimize(stats);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_MaterializeThenAggregate)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Pipeline)
+    ->Args({1 << 16, 1})
+    ->Args({1 << 20, 1})
+    ->Args({1 << 20, 2})
+    ->Unit(benchmark::kMillisecond);
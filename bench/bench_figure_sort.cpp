@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "figure_vector.hpp"
+#include "rectangle.hpp"
+
+using namespace geometry;
+
+namespace {
+
+// Shuffled sizes: widths follow a multiplicative hash of the index.
+const FigureArray<Rectangle<double>>& Source(size_t count) {
+  static FigureArray<Rectangle<double>> source;
+  if (source.Size() != count) {
+    source.Clear();
+    source.ShrinkToFit();
+    source.Reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      double x = static_cast<double>(i);
+      double w = 1.0 + static_cast<double>((i * 2654435761u) % 1000003) * 1e-3;
+      source.EmplaceBack(Point<double>(x, 0.0), Point<double>(x + w, 0.0),
+                         Point<double>(x + w, 2.0), Point<double>(x, 2.0));
+    }
+  }
+  return source;
+}
+
+FigureArray<Rectangle<double>> CopyOf(const FigureArray<Rectangle<double>>& source) {
+  FigureArray<Rectangle<double>> copy;
+  copy.InsertRange(0, &source[0], &source[0] + source.Size());
+  return copy;
+}
+
+double Area(const Rectangle<double>& r) {
+  return static_cast<double>(r);
+}
+
+// Previous approach: copy into a std::vector and sort with an area comparator. The copy is
+// part of that workflow and is timed.
+void BM_VectorSortByArea(benchmark::State& state) {
+  const FigureArray<Rectangle<double>>& source = Source(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::vector<Rectangle<double>> copy(&source[0], &source[0] + source.Size());
+    std::sort(copy.begin(), copy.end(),
+              [](const Rectangle<double>& a, const Rectangle<double>& b) {
+                return static_cast<double>(a) < static_cast<double>(b);
+              });
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SortByArea(benchmark::State& state) {
+  const FigureArray<Rectangle<double>>& source = Source(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Rectangle<double>> arr = CopyOf(source);
+    state.ResumeTiming();
+    arr.SortBy(Area);
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SortByAreaParallel(benchmark::State& state) {
+  const FigureArray<Rectangle<double>>& source = Source(static_cast<size_t>(state.range(0)));
+  ThreadPool pool;
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Rectangle<double>> arr = CopyOf(source);
+    state.ResumeTiming();
+    arr.SortBy(Area, pool);
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_NthElementByArea(benchmark::State& state) {
+  const FigureArray<Rectangle<double>>& source = Source(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Rectangle<double>> arr = CopyOf(source);
+    state.ResumeTiming();
+    arr.NthElement(arr.Size() / 2, Area);
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TopKByArea(benchmark::State& state) {
+  const FigureArray<Rectangle<double>>& source = Source(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    FigureArray<Rectangle<double>> arr = CopyOf(source);
+    state.ResumeTiming();
+    arr.TopK(100, Area);
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_VectorSortByArea)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SortByArea)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SortByAreaParallel)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NthElementByArea)
+    ->Arg(1 << 20)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TopKByArea)
+    ->Arg(1 << 20)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
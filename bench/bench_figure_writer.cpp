@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <ostream>
+#include <streambuf>
+
+#include "alloc_counter.hpp"
+#include "figure_writer.hpp"
+#include "rectangle.hpp"
+
+using namespace geometry;
+
+namespace {
+
+// Counts bytes and drops them, so the benchmarks measure formatting, not I/O.
+class NullBuffer : public std::streambuf {
+ public:
+  size_t BytesWritten() const {
+    return bytes_;
+  }
+
+ protected:
+  std::streamsize xsputn(const char*, std::streamsize count) override {
+    bytes_ += static_cast<size_t>(count);
+    return count;
+  }
+  int_type overflow(int_type c) override {
+    ++bytes_;
+    return traits_type::not_eof(c);
+  }
+
+ private:
+  size_t bytes_ = 0;
+};
+
+const FigureArray<Rectangle<double>>& Figures(size_t count) {
+  static FigureArray<Rectangle<double>> figures;
+  if (figures.Size() != count) {
+    figures.Clear();
+    figures.ShrinkToFit();
+    figures.Reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      double d = static_cast<double>(i % 1000) * 0.37 + 1.0;
+      figures.EmplaceBack(Point<double>(0.0, 0.0), Point<double>(d, 0.0), Point<double>(d, d / 3),
+                          Point<double>(0.0, d / 3));
+    }
+  }
+  return figures;
+}
+
+template <typename Write>
+void RunOutputBenchmark(benchmark::State& state, Write write) {
+  const FigureArray<Rectangle<double>>& figures = Figures(static_cast<size_t>(state.range(0)));
+  size_t bytes = 0;
+  size_t allocations = 0;
+  for (auto _ : state) {
+    NullBuffer buffer;
+    std::ostream os(&buffer);
+    size_t before = bench::AllocationCount();
+    write(os, figures);
+    allocations += bench::AllocationCount() - before;
+    bytes += buffer.BytesWritten();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+  state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations),
+                                                benchmark::Counter::kAvgIterations);
+}
+
+void BM_PrintAll(benchmark::State& state) {
+  RunOutputBenchmark(state, [](std::ostream& os, const auto& figures) { figures.PrintAll(os); });
+}
+
+void BM_WriterText(benchmark::State& state) {
+  RunOutputBenchmark(state, [](std::ostream& os, const auto& figures) {
+    WriteFigures(os, figures, OutputFormat::TEXT);
+  });
+}
+
+void BM_WriterCsv(benchmark::State& state) {
+  RunOutputBenchmark(state, [](std::ostream& os, const auto& figures) {
+    WriteFigures(os, figures, OutputFormat::CSV);
+  });
+}
+
+void BM_WriterJsonLines(benchmark::State& state) {
+  RunOutputBenchmark(state, [](std::ostream& os, const auto& figures) {
+    WriteFigures(os, figures, OutputFormat::JSON_LINES);
+  });
+}
+
+}  // namespace
+
+BENCHMARK(BM_PrintAll)->Arg(1 << 16)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_WriterText)->Arg(1 << 16)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_WriterCsv)->Arg(1 << 16)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_WriterJsonLines)->Arg(1 << 16)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "figure_vector.hpp"
+#include "fixed_block_resource.hpp"
+#include "rectangle.hpp"
+
+using namespace geometry;
+
+namespace {
+
+enum class ResourceKind { GLOBAL_NEW, MONOTONIC, POOL };
+
+Rectangle<double> MakeRectangle(size_t i) {
+  double d = static_cast<double>(i % 100 + 1);
+  return Rectangle<double>(Point<double>(0.0, 0.0), Point<double>(d, 0.0), Point<double>(d, d),
+                           Point<double>(0.0, d));
+}
+
+// Mixed scenes hold shapes through shared_ptr<Figure<T>>: one node allocation per shape.
+template <ResourceKind Kind>
+void BM_BuildSharedScene(benchmark::State& state) {
+  size_t count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    if constexpr (Kind == ResourceKind::GLOBAL_NEW) {
+      std::vector<std::shared_ptr<Figure<double>>> scene;
+      scene.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        scene.push_back(std::make_shared<Rectangle<double>>(MakeRectangle(i)));
+      }
+      benchmark::DoNotOptimize(scene.data());
+    } else if constexpr (Kind == ResourceKind::MONOTONIC) {
+      std::pmr::monotonic_buffer_resource arena;
+      std::pmr::polymorphic_allocator<Rectangle<double>> alloc(&arena);
+      std::pmr::vector<std::shared_ptr<Figure<double>>> scene(&arena);
+      scene.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        scene.push_back(std::allocate_shared<Rectangle<double>>(alloc, MakeRectangle(i)));
+      }
+      benchmark::DoNotOptimize(scene.data());
+    } else {
+      FixedBlockResource pool(128, alignof(std::max_align_t), 4096);
+      std::pmr::polymorphic_allocator<Rectangle<double>> alloc(&pool);
+      std::vector<std::shared_ptr<Figure<double>>> scene;
+      scene.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        scene.push_back(std::allocate_shared<Rectangle<double>>(alloc, MakeRectangle(i)));
+      }
+      benchmark::DoNotOptimize(scene.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Many small arrays built and dropped: the pattern that contends on the global heap.
+template <ResourceKind Kind>
+void BM_BuildSmallArrays(benchmark::State& state) {
+  constexpr size_t ARRAY_COUNT = 1024;
+  constexpr size_t ARRAY_SIZE = 16;
+  for (auto _ : state) {
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::memory_resource* resource =
+        Kind == ResourceKind::GLOBAL_NEW ? std::pmr::get_default_resource() : &arena;
+    for (size_t a = 0; a < ARRAY_COUNT; ++a) {
+      FigureArray<Rectangle<double>> arr(resource);
+      for (size_t i = 0; i < ARRAY_SIZE; ++i) {
+        arr.PushBack(MakeRectangle(i));
+      }
+      benchmark::DoNotOptimize(arr);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * ARRAY_COUNT * ARRAY_SIZE);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_BuildSharedScene, ResourceKind::GLOBAL_NEW)
+    ->Arg(1 << 16)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_BuildSharedScene, ResourceKind::MONOTONIC)
+    ->Arg(1 << 16)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_BuildSharedScene, ResourceKind::POOL)
+    ->Arg(1 << 16)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_BuildSmallArrays, ResourceKind::GLOBAL_NEW)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_BuildSmallArrays, ResourceKind::MONOTONIC)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <thread>
+
+#include "figure_vector.hpp"
+#include "rhombus.hpp"
+
+using namespace geometry;
+
+namespace {
+
+FigureArray<Rhombus<double>> MakeRhombi(size_t count) {
+  FigureArray<Rhombus<double>> arr;
+  arr.Reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    double d = static_cast<double>(i % 100 + 1);
+    arr.PushBack(Rhombus<double>(Point<double>(0.0, d), Point<double>(d, 0.0),
+                                 Point<double>(0.0, -d), Point<double>(-d, 0.0)));
+  }
+  return arr;
+}
+
+void ThreadArgs(benchmark::internal::Benchmark* b) {
+  int64_t max_threads = std::max<int64_t>(1, std::thread::hardware_concurrency());
+  for (int64_t size : {1 << 20, 1 << 23}) {
+    for (int64_t threads = 1; threads < max_threads; threads *= 2) {
+      b->Args({size, threads});
+    }
+    b->Args({size, max_threads});
+  }
+  b->UseRealTime();
+}
+
+void BM_SerialTotalArea(benchmark::State& state) {
+  FigureArray<Rhombus<double>> arr = MakeRhombi(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(arr.GetTotalArea());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ParallelTotalArea(benchmark::State& state) {
+  FigureArray<Rhombus<double>> arr = MakeRhombi(static_cast<size_t>(state.range(0)));
+  ThreadPool pool(static_cast<size_t>(state.range(1)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(arr.GetTotalArea(pool));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ParallelComputeCenters(benchmark::State& state) {
+  FigureArray<Rhombus<double>> arr = MakeRhombi(static_cast<size_t>(state.range(0)));
+  ThreadPool pool(static_cast<size_t>(state.range(1)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(arr.ComputeCenters(pool));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_SerialTotalArea)->Arg(1 << 20)->Arg(1 << 23);
+BENCHMARK(BM_ParallelTotalArea)->Apply(ThreadArgs);
+BENCHMARK(BM_ParallelComputeCenters)->Apply(ThreadArgs);
@@ -0,0 +1,341 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "figure_vector.hpp"
+#include "point.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+// Core operations for each coordinate type, over 10 to 10M elements, so regressions in one
+// scalar instantiation show up. Compare runs with
+//   geometry_bench --benchmark_out=run.json --benchmark_out_format=json
+// (or the bench_json target) and Google Benchmark's tools/compare.py.
+
+namespace {
+
+// Drops everything written to it, so the output benchmarks measure formatting, not I/O.
+class DiscardBuffer : public std::streambuf {
+ protected:
+  std::streamsize xsputn(const char*, std::streamsize count) override {
+    return count;
+  }
+  int_type overflow(int_type c) override {
+    return traits_type::not_eof(c);
+  }
+};
+
+void Sizes(benchmark::internal::Benchmark* b) {
+  b->RangeMultiplier(10)->Range(10, 10'000'000);
+}
+
+template <Scalar T>
+Point<T> MakePoint(size_t i) {
+  return Point<T>(static_cast<T>(i % 1000), static_cast<T>(i % 777));
+}
+
+template <typename Shape>
+Shape MakeShape(size_t i) {
+  using T = ShapeScalar<Shape>;
+  T d = static_cast<T>(i % 100 + 1);
+  T o = static_cast<T>(i % 7);
+  return Shape(Point<T>(o, o), Point<T>(o + d, o), Point<T>(o + d, o + d), Point<T>(o, o + d));
+}
+
+template <Scalar T>
+FigureArray<Rectangle<T>> MakeArray(size_t count) {
+  FigureArray<Rectangle<T>> arr;
+  arr.Reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    arr.PushBack(MakeShape<Rectangle<T>>(i));
+  }
+  return arr;
+}
+
+template <Scalar T>
+void BM_PointConstruct(benchmark::State& state) {
+  size_t i = 0;
+  for (auto _ : state) {
+    Point<T> point(static_cast<T>(i), static_cast<T>(i + 1));
+    benchmark::DoNotOptimize(point);
+    ++i;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <Scalar T>
+void BM_PointDistanceTo(benchmark::State& state) {
+  std::vector<Point<T>> points;
+  points.reserve(static_cast<size_t>(state.range(0)));
+  for (size_t i = 0; i < static_cast<size_t>(state.range(0)); ++i) {
+    points.push_back(MakePoint<T>(i));
+  }
+  for (auto _ : state) {
+    double total = 0.0;
+    for (size_t i = 1; i < points.size(); ++i) {
+      total += points[i - 1].DistanceTo(points[i]);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Shape>
+void BM_ShapeConstruct(benchmark::State& state) {
+  size_t i = 0;
+  for (auto _ : state) {
+    Shape shape = MakeShape<Shape>(i++);
+    benchmark::DoNotOptimize(shape);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Shape>
+void BM_ShapeCopy(benchmark::State& state) {
+  const Shape source = MakeShape<Shape>(7);
+  for (auto _ : state) {
+    Shape copy(source);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Shape>
+void BM_ShapeMove(benchmark::State& state) {
+  Shape source = MakeShape<Shape>(7);
+  for (auto _ : state) {
+    Shape moved(std::move(source));
+    benchmark::DoNotOptimize(moved);
+    source = std::move(moved);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <Scalar T>
+void BM_ArrayPushBack(benchmark::State& state) {
+  size_t count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    FigureArray<Rectangle<T>> arr;
+    for (size_t i = 0; i < count; ++i) {
+      arr.PushBack(MakeShape<Rectangle<T>>(i));
+    }
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <Scalar T>
+void BM_ArrayReserve(benchmark::State& state) {
+  size_t count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    FigureArray<Rectangle<T>> arr;
+    arr.Reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      arr.PushBack(MakeShape<Rectangle<T>>(i));
+    }
+    benchmark::DoNotOptimize(arr);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// One Insert in the middle of an array of range(0) elements plus the Erase at the back that
+// restores the size; pausing the timer around the Erase would cost more than small cases.
+template <Scalar T>
+void BM_ArrayInsert(benchmark::State& state) {
+  FigureArray<Rectangle<T>> arr = MakeArray<T>(static_cast<size_t>(state.range(0)));
+  arr.Reserve(arr.Size() + 1);
+  Rectangle<T> shape = MakeShape<Rectangle<T>>(3);
+  for (auto _ : state) {
+    arr.Insert(arr.Size() / 2, shape);
+    arr.Erase(arr.Size() - 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// One Erase in the middle; a PushBack into reserved space restores the size.
+template <Scalar T>
+void BM_ArrayErase(benchmark::State& state) {
+  FigureArray<Rectangle<T>> arr = MakeArray<T>(static_cast<size_t>(state.range(0)));
+  arr.Reserve(arr.Size() + 1);
+  Rectangle<T> shape = MakeShape<Rectangle<T>>(3);
+  for (auto _ : state) {
+    arr.Erase(arr.Size() / 2);
+    arr.PushBack(shape);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// The running total kept by every insertion and removal.
+template <Scalar T>
+void BM_ArrayTotalArea(benchmark::State& state) {
+  FigureArray<Rectangle<T>> arr = MakeArray<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(arr.GetTotalArea());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Mutable operator[] marks the total stale, so every GetTotalArea rescans the cached areas.
+template <Scalar T>
+void BM_ArrayTotalAreaRefresh(benchmark::State& state) {
+  FigureArray<Rectangle<T>> arr = MakeArray<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    static_cast<void>(arr[0]);
+    benchmark::DoNotOptimize(arr.GetTotalArea());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <Scalar T>
+void BM_ArrayTotalAreaParallel(benchmark::State& state) {
+  FigureArray<Rectangle<T>> arr = MakeArray<T>(static_cast<size_t>(state.range(0)));
+  ThreadPool pool;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(arr.GetTotalArea(pool));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <Scalar T>
+void BM_StreamWrite(benchmark::State& state) {
+  FigureArray<Rectangle<T>> arr = MakeArray<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    DiscardBuffer buffer;
+    std::ostream os(&buffer);
+    for (size_t i = 0; i < arr.Size(); ++i) {
+      os << std::as_const(arr)[i] << '\n';
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <Scalar T>
+void BM_StreamRead(benchmark::State& state) {
+  size_t expected = static_cast<size_t>(state.range(0));
+  // operator>> reads bare coordinates; operator<< writes them in parentheses.
+  std::ostringstream out;
+  for (size_t i = 0; i < expected; ++i) {
+    Rectangle<T> shape = MakeShape<Rectangle<T>>(i);
+    for (size_t k = 0; k < shape.GetVertexCount(); ++k) {
+      out << shape.GetVertex(k).x << ' ' << shape.GetVertex(k).y << ' ';
+    }
+    out << '\n';
+  }
+  std::string text = out.str();
+  for (auto _ : state) {
+    std::istringstream in(text);
+    Rectangle<T> shape;
+    size_t count = 0;
+    while (in >> shape) {
+      ++count;
+    }
+    if (count != expected) {
+      state.SkipWithError("stream read stopped early");
+      break;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+template <Scalar T>
+void BM_ArrayPrintAll(benchmark::State& state) {
+  FigureArray<Rectangle<T>> arr = MakeArray<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    DiscardBuffer buffer;
+    std::ostream os(&buffer);
+    arr.PrintAll(os);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PointConstruct, int);
+BENCHMARK_TEMPLATE(BM_PointConstruct, float);
+BENCHMARK_TEMPLATE(BM_PointConstruct, double);
+
+BENCHMARK_TEMPLATE(BM_PointDistanceTo, int)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_PointDistanceTo, float)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_PointDistanceTo, double)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_ShapeConstruct, Rectangle<int>);
+BENCHMARK_TEMPLATE(BM_ShapeConstruct, Rhombus<int>);
+BENCHMARK_TEMPLATE(BM_ShapeConstruct, Trapezoid<int>);
+BENCHMARK_TEMPLATE(BM_ShapeConstruct, Rectangle<float>);
+BENCHMARK_TEMPLATE(BM_ShapeConstruct, Rhombus<float>);
+BENCHMARK_TEMPLATE(BM_ShapeConstruct, Trapezoid<float>);
+BENCHMARK_TEMPLATE(BM_ShapeConstruct, Rectangle<double>);
+BENCHMARK_TEMPLATE(BM_ShapeConstruct, Rhombus<double>);
+BENCHMARK_TEMPLATE(BM_ShapeConstruct, Trapezoid<double>);
+
+BENCHMARK_TEMPLATE(BM_ShapeCopy, Rectangle<int>);
+BENCHMARK_TEMPLATE(BM_ShapeCopy, Rhombus<int>);
+BENCHMARK_TEMPLATE(BM_ShapeCopy, Trapezoid<int>);
+BENCHMARK_TEMPLATE(BM_ShapeCopy, Rectangle<float>);
+BENCHMARK_TEMPLATE(BM_ShapeCopy, Rhombus<float>);
+BENCHMARK_TEMPLATE(BM_ShapeCopy, Trapezoid<float>);
+BENCHMARK_TEMPLATE(BM_ShapeCopy, Rectangle<double>);
+BENCHMARK_TEMPLATE(BM_ShapeCopy, Rhombus<double>);
+BENCHMARK_TEMPLATE(BM_ShapeCopy, Trapezoid<double>);
+
+BENCHMARK_TEMPLATE(BM_ShapeMove, Rectangle<int>);
+BENCHMARK_TEMPLATE(BM_ShapeMove, Rhombus<int>);
+BENCHMARK_TEMPLATE(BM_ShapeMove, Trapezoid<int>);
+BENCHMARK_TEMPLATE(BM_ShapeMove, Rectangle<float>);
+BENCHMARK_TEMPLATE(BM_ShapeMove, Rhombus<float>);
+BENCHMARK_TEMPLATE(BM_ShapeMove, Trapezoid<float>);
+BENCHMARK_TEMPLATE(BM_ShapeMove, Rectangle<double>);
+BENCHMARK_TEMPLATE(BM_ShapeMove, Rhombus<double>);
+BENCHMARK_TEMPLATE(BM_ShapeMove, Trapezoid<double>);
+
+BENCHMARK_TEMPLATE(BM_ArrayPushBack, int)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayPushBack, float)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayPushBack, double)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_ArrayReserve, int)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayReserve, float)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayReserve, double)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_ArrayInsert, int)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayInsert, float)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayInsert, double)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_ArrayErase, int)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayErase, float)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayErase, double)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_ArrayTotalArea, int)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayTotalArea, float)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayTotalArea, double)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_ArrayTotalAreaRefresh, int)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayTotalAreaRefresh, float)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayTotalAreaRefresh, double)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_ArrayTotalAreaParallel, int)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayTotalAreaParallel, float)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayTotalAreaParallel, double)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_StreamWrite, int)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_StreamWrite, float)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_StreamWrite, double)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_StreamRead, int)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_StreamRead, float)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_StreamRead, double)->Apply(Sizes);
+
+BENCHMARK_TEMPLATE(BM_ArrayPrintAll, int)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayPrintAll, float)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_ArrayPrintAll, double)->Apply(Sizes);
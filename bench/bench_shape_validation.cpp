@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "figure_batch.hpp"
+
+using namespace geometry;
+
+namespace {
+
+// Rotated squares, which every shape type accepts, with a random quarter nudged out of
+// shape so the per-figure branches are unpredictable.
+template <template <typename> class Shape>
+FigureArray<Shape<double>> MakeFigures(size_t count) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> angle(0.0, 6.28);
+  FigureArray<Shape<double>> figures;
+  figures.Reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    double d = static_cast<double>(i % 100 + 1);
+    Shape<double> shape(Point<double>(0.0, 0.0), Point<double>(d, 0.0), Point<double>(d, d),
+                        Point<double>(rng() % 4 == 0 ? 0.5 * d : 0.0, d));
+    shape.Rotate(angle(rng));
+    figures.PushBack(shape);
+  }
+  return figures;
+}
+
+template <template <typename> class Shape>
+void BM_ValidateEach(benchmark::State& state) {
+  FigureArray<Shape<double>> figures = MakeFigures<Shape>(static_cast<size_t>(state.range(0)));
+  std::vector<uint8_t> defects(figures.Size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < figures.Size(); ++i) {
+      defects[i] = figures[i].Validate();
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <template <typename> class Shape>
+void BM_ValidateAll(benchmark::State& state) {
+  FigureArray<Shape<double>> figures = MakeFigures<Shape>(static_cast<size_t>(state.range(0)));
+  SimdLevel saved = GetSimdLevel();
+  SetSimdLevel(static_cast<SimdLevel>(state.range(1)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ValidateAll(figures));
+  }
+  SetSimdLevel(saved);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <template <typename> class Shape>
+void BM_BatchValidate(benchmark::State& state) {
+  FigureBatch<double, Shape> batch(MakeFigures<Shape>(static_cast<size_t>(state.range(0))));
+  std::vector<uint8_t> defects(batch.Size());
+  SimdLevel saved = GetSimdLevel();
+  SetSimdLevel(static_cast<SimdLevel>(state.range(1)));
+  for (auto _ : state) {
+    batch.Validate(defects.data());
+    benchmark::ClobberMemory();
+  }
+  SetSimdLevel(saved);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void SimdArgs(benchmark::internal::Benchmark* b) {
+  for (int64_t size : {1 << 16, 1 << 20}) {
+    for (int64_t level : {0, 2}) {
+      b->Args({size, level});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ValidateEach, Rectangle)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_ValidateEach, Rhombus)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_ValidateEach, Trapezoid)->Arg(1 << 16)->Arg(1 << 20);
+
+BENCHMARK_TEMPLATE(BM_ValidateAll, Rectangle)->Apply(SimdArgs);
+BENCHMARK_TEMPLATE(BM_ValidateAll, Rhombus)->Apply(SimdArgs);
+BENCHMARK_TEMPLATE(BM_ValidateAll, Trapezoid)->Apply(SimdArgs);
+
+BENCHMARK_TEMPLATE(BM_BatchValidate, Rectangle)->Apply(SimdArgs);
+BENCHMARK_TEMPLATE(BM_BatchValidate, Rhombus)->Apply(SimdArgs);
+BENCHMARK_TEMPLATE(BM_BatchValidate, Trapezoid)->Apply(SimdArgs);
@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "point.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+namespace {
+
+// Previous shape layout: every vertex lives in its own heap allocation.
+template <Scalar T>
+class LegacyRectangle {
+ public:
+  LegacyRectangle(const Point<T>& p1, const Point<T>& p2, const Point<T>& p3, const Point<T>& p4) {
+    vertices_[0] = std::make_unique<Point<T>>(p1);
+    vertices_[1] = std::make_unique<Point<T>>(p2);
+    vertices_[2] = std::make_unique<Point<T>>(p3);
+    vertices_[3] = std::make_unique<Point<T>>(p4);
+  }
+
+  LegacyRectangle(const LegacyRectangle& other) {
+    for (size_t i = 0; i < VERTEX_COUNT; ++i) {
+      vertices_[i] = std::make_unique<Point<T>>(*other.vertices_[i]);
+    }
+  }
+
+  operator double() const {
+    double side1 = vertices_[0]->DistanceTo(*vertices_[1]);
+    double side2 = vertices_[1]->DistanceTo(*vertices_[2]);
+    return side1 * side2;
+  }
+
+ private:
+  static constexpr size_t VERTEX_COUNT = 4;
+  std::unique_ptr<Point<T>> vertices_[VERTEX_COUNT];
+};
+
+template <typename Shape>
+Shape MakeShape(int i) {
+  double d = static_cast<double>(i % 100 + 1);
+  return Shape(Point<double>(0.0, 0.0), Point<double>(d, 0.0), Point<double>(d, d),
+               Point<double>(0.0, d));
+}
+
+template <typename Shape>
+void BM_Construct(benchmark::State& state) {
+  int i = 0;
+  for (auto _ : state) {
+    Shape shape = MakeShape<Shape>(i++);
+    benchmark::DoNotOptimize(shape);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Shape>
+void BM_Copy(benchmark::State& state) {
+  const Shape source = MakeShape<Shape>(7);
+  for (auto _ : state) {
+    Shape copy(source);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Shape>
+void BM_Area(benchmark::State& state) {
+  std::vector<Shape> shapes;
+  shapes.reserve(static_cast<size_t>(state.range(0)));
+  for (int i = 0; i < state.range(0); ++i) {
+    shapes.push_back(MakeShape<Shape>(i));
+  }
+  for (auto _ : state) {
+    double total = 0.0;
+    for (const Shape& shape : shapes) {
+      total += static_cast<double>(shape);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+std::vector<Rectangle<int>> MakeIntegerRectangles(size_t count) {
+  std::vector<Rectangle<int>> shapes;
+  shapes.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    int a = static_cast<int>(i % 100 + 1);
+    int b = static_cast<int>(i % 37 + 1);
+    // Rotated rectangle with integer vertices: sides (a, b) and (-b, a).
+    shapes.emplace_back(Point<int>(0, 0), Point<int>(a, b), Point<int>(a - b, a + b),
+                        Point<int>(-b, a));
+  }
+  return shapes;
+}
+
+// Previous integer path: two DistanceTo square roots per rectangle.
+void BM_IntegerAreaSqrt(benchmark::State& state) {
+  std::vector<Rectangle<int>> shapes = MakeIntegerRectangles(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    double total = 0.0;
+    for (const Rectangle<int>& shape : shapes) {
+      total += shape.GetVertex(0).DistanceTo(shape.GetVertex(1)) *
+               shape.GetVertex(1).DistanceTo(shape.GetVertex(2));
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_IntegerTwiceArea(benchmark::State& state) {
+  std::vector<Rectangle<int>> shapes = MakeIntegerRectangles(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    double total = 0.0;
+    for (const Rectangle<int>& shape : shapes) {
+      total += 0.5 * ToDouble(shape.TwiceArea());
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Construct, LegacyRectangle<double>);
+BENCHMARK_TEMPLATE(BM_Construct, Rectangle<double>);
+BENCHMARK_TEMPLATE(BM_Construct, Rhombus<double>);
+BENCHMARK_TEMPLATE(BM_Construct, Trapezoid<double>);
+
+BENCHMARK_TEMPLATE(BM_Copy, LegacyRectangle<double>);
+BENCHMARK_TEMPLATE(BM_Copy, Rectangle<double>);
+BENCHMARK_TEMPLATE(BM_Copy, Rhombus<double>);
+BENCHMARK_TEMPLATE(BM_Copy, Trapezoid<double>);
+
+BENCHMARK_TEMPLATE(BM_Area, LegacyRectangle<double>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Area, Rectangle<double>)->Range(1 << 10, 1 << 20);
+
+BENCHMARK(BM_IntegerAreaSqrt)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_IntegerTwiceArea)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "rectangle.hpp"
+#include "spatial_index.hpp"
+
+using namespace geometry;
+
+namespace {
+
+constexpr double EXTENT = 100000.0;
+
+struct Scene {
+  FigureArray<Rectangle<double>> figures;
+  std::unique_ptr<GridIndex<Rectangle<double>>> index;
+};
+
+// Rectangles of side up to 0.2% of the extent scattered uniformly; built once per size.
+const Scene& GetScene(size_t count) {
+  static size_t built_count = 0;
+  static Scene scene;
+  if (built_count != count) {
+    scene.index.reset();
+    scene.figures.Clear();
+    scene.figures.ShrinkToFit();
+    scene.figures.Reserve(count);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> position(0.0, EXTENT);
+    std::uniform_real_distribution<double> size(1.0, EXTENT / 500.0);
+    for (size_t i = 0; i < count; ++i) {
+      double x = position(rng);
+      double y = position(rng);
+      double w = size(rng);
+      double h = size(rng);
+      scene.figures.EmplaceBack(Point<double>(x, y), Point<double>(x + w, y),
+                                Point<double>(x + w, y + h), Point<double>(x, y + h));
+    }
+    scene.index = std::make_unique<GridIndex<Rectangle<double>>>(scene.figures);
+    built_count = count;
+  }
+  return scene;
+}
+
+std::vector<BoundingBox> MakeWindows() {
+  std::mt19937 rng(5);
+  std::uniform_real_distribution<double> position(0.0, EXTENT);
+  std::vector<BoundingBox> windows;
+  for (int i = 0; i < 64; ++i) {
+    double x = position(rng);
+    double y = position(rng);
+    windows.emplace_back(x, y, x + EXTENT / 100.0, y + EXTENT / 100.0);
+  }
+  return windows;
+}
+
+void BM_WindowLinearScan(benchmark::State& state) {
+  const Scene& scene = GetScene(static_cast<size_t>(state.range(0)));
+  std::vector<BoundingBox> windows = MakeWindows();
+  size_t query = 0;
+  for (auto _ : state) {
+    const BoundingBox& window = windows[query++ % windows.size()];
+    std::vector<size_t> result;
+    for (size_t i = 0; i < scene.figures.Size(); ++i) {
+      if (BoundingBox::Of(scene.figures[i]).Intersects(window)) {
+        result.push_back(i);
+      }
+    }
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+void BM_WindowGridIndex(benchmark::State& state) {
+  const Scene& scene = GetScene(static_cast<size_t>(state.range(0)));
+  std::vector<BoundingBox> windows = MakeWindows();
+  size_t query = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(scene.index->QueryWindow(windows[query++ % windows.size()]));
+  }
+}
+
+void BM_NearestLinearScan(benchmark::State& state) {
+  const Scene& scene = GetScene(static_cast<size_t>(state.range(0)));
+  std::vector<BoundingBox> windows = MakeWindows();
+  size_t query = 0;
+  std::vector<std::pair<double, size_t>> distances(scene.figures.Size());
+  for (auto _ : state) {
+    const BoundingBox& window = windows[query++ % windows.size()];
+    for (size_t i = 0; i < scene.figures.Size(); ++i) {
+      Point<double> center = scene.figures[i].GetCenter();
+      double dx = center.x - window.min_x;
+      double dy = center.y - window.min_y;
+      distances[i] = {dx * dx + dy * dy, i};
+    }
+    std::partial_sort(distances.begin(), distances.begin() + 10, distances.end());
+    benchmark::DoNotOptimize(distances.data());
+  }
+}
+
+void BM_NearestGridIndex(benchmark::State& state) {
+  const Scene& scene = GetScene(static_cast<size_t>(state.range(0)));
+  std::vector<BoundingBox> windows = MakeWindows();
+  size_t query = 0;
+  for (auto _ : state) {
+    const BoundingBox& window = windows[query++ % windows.size()];
+    benchmark::DoNotOptimize(
+        scene.index->Nearest(Point<double>(window.min_x, window.min_y), 10));
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_WindowLinearScan)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_WindowGridIndex)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_NearestLinearScan)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_NearestGridIndex)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMicrosecond);
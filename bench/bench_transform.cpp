@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <thread>
+
+#include "figure_vector.hpp"
+#include "rectangle.hpp"
+
+using namespace geometry;
+
+namespace {
+
+constexpr int64_t VERTICES_PER_FIGURE = 4;
+
+template <Scalar T>
+FigureArray<Rectangle<T>> MakeRectangles(size_t count) {
+  FigureArray<Rectangle<T>> arr;
+  arr.Reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    T d = static_cast<T>(i % 100 + 1);
+    arr.EmplaceBack(Point<T>(0, 0), Point<T>(d, 0), Point<T>(d, d), Point<T>(0, d));
+  }
+  return arr;
+}
+
+// A rotation keeps coordinates bounded however many iterations run.
+const AffineTransform ROTATION = AffineTransform::Rotation(1e-3, Point<double>(50.0, 50.0));
+
+// What moving a scene costs without in-place transforms: build every shape anew.
+template <Scalar T>
+void BM_RebuildShapes(benchmark::State& state) {
+  FigureArray<Rectangle<T>> arr = MakeRectangles<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (size_t i = 0; i < arr.Size(); ++i) {
+      const Rectangle<T>& old = arr[i];
+      arr[i] = Rectangle<T>(ROTATION.Apply(old.GetVertex(0)), ROTATION.Apply(old.GetVertex(1)),
+                            ROTATION.Apply(old.GetVertex(2)), ROTATION.Apply(old.GetVertex(3)));
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * VERTICES_PER_FIGURE);
+}
+
+template <Scalar T>
+void BM_Transform(benchmark::State& state) {
+  FigureArray<Rectangle<T>> arr = MakeRectangles<T>(static_cast<size_t>(state.range(0)));
+  SimdLevel saved = GetSimdLevel();
+  SetSimdLevel(static_cast<SimdLevel>(state.range(1)));
+  for (auto _ : state) {
+    arr.Transform(ROTATION);
+    benchmark::ClobberMemory();
+  }
+  SetSimdLevel(saved);
+  state.SetItemsProcessed(state.iterations() * state.range(0) * VERTICES_PER_FIGURE);
+}
+
+template <Scalar T>
+void BM_ParallelTransform(benchmark::State& state) {
+  FigureArray<Rectangle<T>> arr = MakeRectangles<T>(static_cast<size_t>(state.range(0)));
+  ThreadPool pool(static_cast<size_t>(state.range(1)));
+  for (auto _ : state) {
+    arr.Transform(ROTATION, pool);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * VERTICES_PER_FIGURE);
+}
+
+void SimdArgs(benchmark::internal::Benchmark* b) {
+  for (int64_t level : {0, 1, 2}) {
+    b->Args({1 << 20, level});
+  }
+}
+
+void ThreadArgs(benchmark::internal::Benchmark* b) {
+  int64_t max_threads = std::max<int64_t>(1, std::thread::hardware_concurrency());
+  for (int64_t threads = 1; threads < max_threads; threads *= 2) {
+    b->Args({1 << 20, threads});
+  }
+  b->Args({1 << 20, max_threads});
+  b->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_RebuildShapes, double)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Transform, double)->Apply(SimdArgs);
+BENCHMARK_TEMPLATE(BM_ParallelTransform, double)->Apply(ThreadArgs);
+BENCHMARK_TEMPLATE(BM_RebuildShapes, int)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Transform, int)->Apply(SimdArgs);
+BENCHMARK_TEMPLATE(BM_ParallelTransform, int)->Apply(ThreadArgs);
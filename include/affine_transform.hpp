@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+
+#include "batch_kernels.hpp"
+#include "point.hpp"
+
+namespace geometry {
+
+// 2D affine map (x, y) -> (a x + b y + tx, c x + d y + ty), evaluated in double precision.
+struct AffineTransform {
+  double a;
+  double b;
+  double c;
+  double d;
+  double tx;
+  double ty;
+
+  static AffineTransform Identity();
+  static AffineTransform Translation(double dx, double dy);
+  // Counter-clockwise rotation about the origin.
+  static AffineTransform Rotation(double radians);
+  static AffineTransform Rotation(double radians, const Point<double>& pivot);
+  // Scaling about the origin.
+  static AffineTransform Scaling(double sx, double sy);
+
+  // The transform that applies *this first and `next` second.
+  AffineTransform Then(const AffineTransform& next) const;
+  double Determinant() const;
+
+  template <Scalar T>
+  Point<T> Apply(const Point<T>& point) const;
+
+  bool operator==(const AffineTransform& other) const = default;
+};
+
+// Converts a transformed coordinate back to T. Floating types are narrowed with a plain
+// cast. Integer types round to nearest with ties away from zero (std::round), saturate at
+// the limits of T, and map NaN to 0.
+template <Scalar T>
+T RoundCoordinate(double value);
+
+// Transforms `count` points in place. Gives the same result as Apply on every point; float,
+// double and int32_t points use the SIMD level selected by SetSimdLevel.
+template <Scalar T>
+void TransformPoints(const AffineTransform& transform, Point<T>* points, size_t count);
+
+// TransformPoints with the kernel for the SIMD level chosen once, at construction, for
+// applying one transform to many small point sets such as the vertices of each shape.
+template <Scalar T>
+class PointTransformer {
+ public:
+  explicit PointTransformer(const AffineTransform& transform);
+
+  const AffineTransform& GetTransform() const;
+  void operator()(Point<T>* points, size_t count) const;
+
+ private:
+  using Kernel = void (*)(const AffineTransform&, Point<T>*, size_t);
+
+  AffineTransform transform_;
+  Kernel kernel_;
+};
+
+}  // namespace geometry
+
+#include "affine_transform.ipp"
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace geometry {
+
+inline AffineTransform AffineTransform::Identity() {
+  return {1.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+}
+
+inline AffineTransform AffineTransform::Translation(double dx, double dy) {
+  return {1.0, 0.0, 0.0, 1.0, dx, dy};
+}
+
+inline AffineTransform AffineTransform::Rotation(double radians) {
+  double cos = std::cos(radians);
+  double sin = std::sin(radians);
+  return {cos, -sin, sin, cos, 0.0, 0.0};
+}
+
+inline AffineTransform AffineTransform::Rotation(double radians, const Point<double>& pivot) {
+  return Translation(-pivot.x, -pivot.y)
+      .Then(Rotation(radians))
+      .Then(Translation(pivot.x, pivot.y));
+}
+
+inline AffineTransform AffineTransform::Scaling(double sx, double sy) {
+  return {sx, 0.0, 0.0, sy, 0.0, 0.0};
+}
+
+inline AffineTransform AffineTransform::Then(const AffineTransform& next) const {
+  return {next.a * a + next.b * c,
+          next.a * b + next.b * d,
+          next.c * a + next.d * c,
+          next.c * b + next.d * d,
+          next.a * tx + next.b * ty + next.tx,
+          next.c * tx + next.d * ty + next.ty};
+}
+
+inline double AffineTransform::Determinant() const {
+  return a * d - b * c;
+}
+
+template <Scalar T>
+Point<T> AffineTransform::Apply(const Point<T>& point) const {
+  double x = static_cast<double>(point.x);
+  double y = static_cast<double>(point.y);
+  return Point<T>(RoundCoordinate<T>(a * x + b * y + tx), RoundCoordinate<T>(c * x + d * y + ty));
+}
+
+template <Scalar T>
+T RoundCoordinate(double value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return static_cast<T>(value);
+  } else {
+    if (std::isnan(value)) {
+      return T{0};
+    }
+    double rounded = std::round(value);
+    if (rounded <= static_cast<double>(std::numeric_limits<T>::lowest())) {
+      return std::numeric_limits<T>::lowest();
+    }
+    if (rounded >= static_cast<double>(std::numeric_limits<T>::max())) {
+      return std::numeric_limits<T>::max();
+    }
+    return static_cast<T>(rounded);
+  }
+}
+
+namespace kernels {
+
+template <Scalar T>
+void TransformScalar(const AffineTransform& transform, Point<T>* points, size_t count,
+                     size_t begin) {
+  for (size_t i = begin; i < count; ++i) {
+    points[i] = transform.Apply(points[i]);
+  }
+}
+
+#if GEOMETRY_SIMD_X86
+
+// Points are stored as interleaved x, y pairs. With v = (x, y) and its swap (y, x), the
+// result is v * (a, d) + swap * (b, c) + (tx, ty): the same products and sums as Apply.
+
+GEOMETRY_TARGET_AVX2 inline __m256d Transform2Avx2(__m256d v, __m256d diagonal,
+                                                   __m256d cross, __m256d offset) {
+  __m256d swapped = _mm256_permute_pd(v, 0b0101);
+  return _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(v, diagonal), _mm256_mul_pd(swapped, cross)),
+                       offset);
+}
+
+// Vector form of RoundCoordinate<int32_t>.
+GEOMETRY_TARGET_AVX2 inline __m128i RoundToInt32Avx2(__m256d v) {
+  const __m256d sign_mask = _mm256_set1_pd(-0.0);
+  __m256d truncated = _mm256_round_pd(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  __m256d fraction = _mm256_andnot_pd(sign_mask, _mm256_sub_pd(v, truncated));
+  __m256d round_away = _mm256_cmp_pd(fraction, _mm256_set1_pd(0.5), _CMP_GE_OQ);
+  __m256d unit = _mm256_or_pd(_mm256_set1_pd(1.0), _mm256_and_pd(v, sign_mask));
+  __m256d rounded = _mm256_add_pd(truncated, _mm256_and_pd(round_away, unit));
+  rounded = _mm256_and_pd(rounded, _mm256_cmp_pd(v, v, _CMP_ORD_Q));
+  rounded = _mm256_max_pd(rounded, _mm256_set1_pd(std::numeric_limits<int32_t>::lowest()));
+  rounded = _mm256_min_pd(rounded, _mm256_set1_pd(std::numeric_limits<int32_t>::max()));
+  return _mm256_cvttpd_epi32(rounded);
+}
+
+template <Scalar T>
+GEOMETRY_TARGET_AVX2 size_t TransformAvx2(const AffineTransform& transform, Point<T>* points,
+                                          size_t count) {
+  const __m256d diagonal = _mm256_setr_pd(transform.a, transform.d, transform.a, transform.d);
+  const __m256d cross = _mm256_setr_pd(transform.b, transform.c, transform.b, transform.c);
+  const __m256d offset = _mm256_setr_pd(transform.tx, transform.ty, transform.tx, transform.ty);
+  T* data = &points[0].x;
+  size_t i = 0;
+  for (; i + 2 <= count; i += 2) {
+    T* p = data + 2 * i;
+    if constexpr (std::is_same_v<T, double>) {
+      _mm256_storeu_pd(p, Transform2Avx2(_mm256_loadu_pd(p), diagonal, cross, offset));
+    } else if constexpr (std::is_same_v<T, float>) {
+      __m256d v = _mm256_cvtps_pd(_mm_loadu_ps(p));
+      _mm_storeu_ps(p, _mm256_cvtpd_ps(Transform2Avx2(v, diagonal, cross, offset)));
+    } else {
+      __m128i* address = reinterpret_cast<__m128i*>(p);
+      __m256d v = _mm256_cvtepi32_pd(_mm_loadu_si128(address));
+      _mm_storeu_si128(address, RoundToInt32Avx2(Transform2Avx2(v, diagonal, cross, offset)));
+    }
+  }
+  return i;
+}
+
+template <Scalar T>
+GEOMETRY_TARGET_SSE2 size_t TransformSse2(const AffineTransform& transform, Point<T>* points,
+                                          size_t count) {
+  const __m128d diagonal = _mm_setr_pd(transform.a, transform.d);
+  const __m128d cross = _mm_setr_pd(transform.b, transform.c);
+  const __m128d offset = _mm_setr_pd(transform.tx, transform.ty);
+  T* data = &points[0].x;
+  for (size_t i = 0; i < count; ++i) {
+    T* p = data + 2 * i;
+    __m128d v;
+    if constexpr (std::is_same_v<T, double>) {
+      v = _mm_loadu_pd(p);
+    } else {
+      v = _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+    }
+    __m128d swapped = _mm_shuffle_pd(v, v, 0b01);
+    __m128d result =
+        _mm_add_pd(_mm_add_pd(_mm_mul_pd(v, diagonal), _mm_mul_pd(swapped, cross)), offset);
+    if constexpr (std::is_same_v<T, double>) {
+      _mm_storeu_pd(p, result);
+    } else {
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(_mm_cvtpd_ps(result)));
+    }
+  }
+  return count;
+}
+
+// Whole-range entry points for PointTransformer: the vector kernel, then the scalar tail.
+
+template <Scalar T>
+GEOMETRY_TARGET_AVX2 void TransformPointsAvx2(const AffineTransform& transform,
+                                              Point<T>* points, size_t count) {
+  size_t done = TransformAvx2(transform, points, count);
+  TransformScalar(transform, points, count, done);
+}
+
+template <Scalar T>
+GEOMETRY_TARGET_SSE2 void TransformPointsSse2(const AffineTransform& transform,
+                                              Point<T>* points, size_t count) {
+  size_t done = TransformSse2(transform, points, count);
+  TransformScalar(transform, points, count, done);
+}
+
+#endif  // GEOMETRY_SIMD_X86
+
+template <Scalar T>
+void TransformPointsScalar(const AffineTransform& transform, Point<T>* points, size_t count) {
+  TransformScalar(transform, points, count, 0);
+}
+
+}  // namespace kernels
+
+template <Scalar T>
+void TransformPoints(const AffineTransform& transform, Point<T>* points, size_t count) {
+  PointTransformer<T> transformer(transform);
+  transformer(points, count);
+}
+
+template <Scalar T>
+PointTransformer<T>::PointTransformer(const AffineTransform& transform)
+    : transform_(transform), kernel_(&kernels::TransformPointsScalar<T>) {
+  static_assert(sizeof(Point<T>) == 2 * sizeof(T), "SIMD paths assume interleaved x, y");
+#if GEOMETRY_SIMD_X86
+  if constexpr (kernels::HAS_VECTOR_LOAD<T>) {
+    switch (GetSimdLevel()) {
+      case SimdLevel::AVX2:
+        kernel_ = &kernels::TransformPointsAvx2<T>;
+        break;
+      case SimdLevel::SSE2:
+        // SSE2 lacks a truncating round for the integer path.
+        if constexpr (std::is_floating_point_v<T>) {
+          kernel_ = &kernels::TransformPointsSse2<T>;
+        }
+        break;
+      case SimdLevel::SCALAR:
+        break;
+    }
+  }
+#endif
+}
+
+template <Scalar T>
+const AffineTransform& PointTransformer<T>::GetTransform() const {
+  return transform_;
+}
+
+template <Scalar T>
+void PointTransformer<T>::operator()(Point<T>* points, size_t count) const {
+  kernel_(transform_, points, count);
+}
+
+}  // namespace geometry
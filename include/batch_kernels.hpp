@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "point.hpp"
+#include "shape_validation.hpp"
+#include "simd.hpp"
+
+namespace geometry {
+
+enum class AreaFormula {
+  SIDES,      // Rectangle: |v0 v1| * |v1 v2|
+  DIAGONALS,  // Rhombus: |v0 v2| * |v1 v3| / 2
+  SHOELACE,   // Trapezoid: shoelace formula over v0..v3
+};
+
+// Structure-of-arrays view of `size` quadrilaterals: x[k][i], y[k][i] is vertex k of shape i.
+template <Scalar T>
+struct VertexColumns {
+  static constexpr size_t VERTEX_COUNT = 4;
+
+  const T* x[VERTEX_COUNT];
+  const T* y[VERTEX_COUNT];
+  size_t size;
+};
+
+template <AreaFormula F, Scalar T>
+void BatchAreas(const VertexColumns<T>& columns, double* areas);
+
+template <AreaFormula F, Scalar T>
+double BatchTotalArea(const VertexColumns<T>& columns);
+
+template <Scalar T>
+void BatchCenters(const VertexColumns<T>& columns, double* center_x, double* center_y);
+
+// defects[i] = ValidateQuadrilateral<KIND> of shape i.
+template <ShapeKind KIND, Scalar T>
+void BatchValidate(const VertexColumns<T>& columns, uint8_t* defects);
+
+}  // namespace geometry
+
+#include "batch_kernels.ipp"
@@ -0,0 +1,450 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+namespace geometry {
+
+namespace kernels {
+
+template <AreaFormula F>
+inline double Area(const double x[4], const double y[4]) {
+  if constexpr (F == AreaFormula::SIDES) {
+    double dx1 = x[1] - x[0];
+    double dy1 = y[1] - y[0];
+    double dx2 = x[2] - x[1];
+    double dy2 = y[2] - y[1];
+    return std::sqrt(dx1 * dx1 + dy1 * dy1) * std::sqrt(dx2 * dx2 + dy2 * dy2);
+  } else if constexpr (F == AreaFormula::DIAGONALS) {
+    double dx1 = x[2] - x[0];
+    double dy1 = y[2] - y[0];
+    double dx2 = x[3] - x[1];
+    double dy2 = y[3] - y[1];
+    return std::sqrt(dx1 * dx1 + dy1 * dy1) * std::sqrt(dx2 * dx2 + dy2 * dy2) / 2.0;
+  } else {
+    return 0.5 * std::abs((x[0] * y[1] + x[1] * y[2] + x[2] * y[3] + x[3] * y[0]) -
+                          (y[0] * x[1] + y[1] * x[2] + y[2] * x[3] + y[3] * x[0]));
+  }
+}
+
+template <Scalar T>
+inline void Load(const VertexColumns<T>& columns, size_t i, double x[4], double y[4]) {
+  for (size_t k = 0; k < VertexColumns<T>::VERTEX_COUNT; ++k) {
+    x[k] = static_cast<double>(columns.x[k][i]);
+    y[k] = static_cast<double>(columns.y[k][i]);
+  }
+}
+
+template <AreaFormula F, Scalar T>
+void AreasScalar(const VertexColumns<T>& columns, double* areas, size_t begin) {
+  double x[4];
+  double y[4];
+  for (size_t i = begin; i < columns.size; ++i) {
+    Load(columns, i, x, y);
+    areas[i] = Area<F>(x, y);
+  }
+}
+
+template <AreaFormula F, Scalar T>
+double TotalAreaScalar(const VertexColumns<T>& columns, size_t begin) {
+  double x[4];
+  double y[4];
+  double total = 0.0;
+  for (size_t i = begin; i < columns.size; ++i) {
+    Load(columns, i, x, y);
+    total += Area<F>(x, y);
+  }
+  return total;
+}
+
+template <Scalar T>
+void CentersScalar(const VertexColumns<T>& columns, double* center_x, double* center_y,
+                   size_t begin) {
+  double x[4];
+  double y[4];
+  for (size_t i = begin; i < columns.size; ++i) {
+    Load(columns, i, x, y);
+    center_x[i] = (x[0] + x[1] + x[2] + x[3]) / 4.0;
+    center_y[i] = (y[0] + y[1] + y[2] + y[3]) / 4.0;
+  }
+}
+
+template <ShapeKind KIND, Scalar T>
+void ValidateScalar(const VertexColumns<T>& columns, uint8_t* defects, size_t begin) {
+  double x[4];
+  double y[4];
+  for (size_t i = begin; i < columns.size; ++i) {
+    Load(columns, i, x, y);
+    defects[i] = ValidateQuadrilateral<KIND>(x, y, VALIDATION_TOLERANCE<T>);
+  }
+}
+
+#if GEOMETRY_SIMD_X86
+
+// Scalar types the vector paths can widen to double lanes; everything else runs scalar.
+template <Scalar T>
+constexpr bool HAS_VECTOR_LOAD = std::is_same_v<T, double> || std::is_same_v<T, float> ||
+                                 std::is_same_v<T, int32_t>;
+
+template <Scalar T>
+GEOMETRY_TARGET_AVX2 inline __m256d Load4(const T* p) {
+  if constexpr (std::is_same_v<T, double>) {
+    return _mm256_loadu_pd(p);
+  } else if constexpr (std::is_same_v<T, float>) {
+    return _mm256_cvtps_pd(_mm_loadu_ps(p));
+  } else {
+    return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+  }
+}
+
+GEOMETRY_TARGET_AVX2 inline __m256d Length4(__m256d dx, __m256d dy) {
+  return _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)));
+}
+
+template <AreaFormula F>
+GEOMETRY_TARGET_AVX2 inline __m256d Area4(const __m256d x[4], const __m256d y[4]) {
+  if constexpr (F == AreaFormula::SIDES) {
+    __m256d side1 = Length4(_mm256_sub_pd(x[1], x[0]), _mm256_sub_pd(y[1], y[0]));
+    __m256d side2 = Length4(_mm256_sub_pd(x[2], x[1]), _mm256_sub_pd(y[2], y[1]));
+    return _mm256_mul_pd(side1, side2);
+  } else if constexpr (F == AreaFormula::DIAGONALS) {
+    __m256d d1 = Length4(_mm256_sub_pd(x[2], x[0]), _mm256_sub_pd(y[2], y[0]));
+    __m256d d2 = Length4(_mm256_sub_pd(x[3], x[1]), _mm256_sub_pd(y[3], y[1]));
+    return _mm256_div_pd(_mm256_mul_pd(d1, d2), _mm256_set1_pd(2.0));
+  } else {
+    __m256d forward = _mm256_add_pd(
+        _mm256_add_pd(_mm256_mul_pd(x[0], y[1]), _mm256_mul_pd(x[1], y[2])),
+        _mm256_add_pd(_mm256_mul_pd(x[2], y[3]), _mm256_mul_pd(x[3], y[0])));
+    __m256d backward = _mm256_add_pd(
+        _mm256_add_pd(_mm256_mul_pd(y[0], x[1]), _mm256_mul_pd(y[1], x[2])),
+        _mm256_add_pd(_mm256_mul_pd(y[2], x[3]), _mm256_mul_pd(y[3], x[0])));
+    __m256d diff = _mm256_andnot_pd(_mm256_set1_pd(-0.0), _mm256_sub_pd(forward, backward));
+    return _mm256_mul_pd(_mm256_set1_pd(0.5), diff);
+  }
+}
+
+template <Scalar T>
+GEOMETRY_TARGET_AVX2 inline void Load4(const VertexColumns<T>& columns, size_t i, __m256d x[4],
+                                       __m256d y[4]) {
+  for (size_t k = 0; k < VertexColumns<T>::VERTEX_COUNT; ++k) {
+    x[k] = Load4(columns.x[k] + i);
+    y[k] = Load4(columns.y[k] + i);
+  }
+}
+
+template <AreaFormula F, Scalar T>
+GEOMETRY_TARGET_AVX2 size_t AreasAvx2(const VertexColumns<T>& columns, double* areas) {
+  __m256d x[4];
+  __m256d y[4];
+  size_t i = 0;
+  for (; i + 4 <= columns.size; i += 4) {
+    Load4(columns, i, x, y);
+    _mm256_storeu_pd(areas + i, Area4<F>(x, y));
+  }
+  return i;
+}
+
+template <AreaFormula F, Scalar T>
+GEOMETRY_TARGET_AVX2 size_t TotalAreaAvx2(const VertexColumns<T>& columns, double* total) {
+  __m256d x[4];
+  __m256d y[4];
+  __m256d sum = _mm256_setzero_pd();
+  size_t i = 0;
+  for (; i + 4 <= columns.size; i += 4) {
+    Load4(columns, i, x, y);
+    sum = _mm256_add_pd(sum, Area4<F>(x, y));
+  }
+  alignas(32) double lanes[4];
+  _mm256_store_pd(lanes, sum);
+  *total = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  return i;
+}
+
+template <Scalar T>
+GEOMETRY_TARGET_AVX2 size_t CentersAvx2(const VertexColumns<T>& columns, double* center_x,
+                                        double* center_y) {
+  __m256d x[4];
+  __m256d y[4];
+  const __m256d four = _mm256_set1_pd(4.0);
+  size_t i = 0;
+  for (; i + 4 <= columns.size; i += 4) {
+    Load4(columns, i, x, y);
+    __m256d sx = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(x[0], x[1]), x[2]), x[3]);
+    __m256d sy = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(y[0], y[1]), y[2]), y[3]);
+    _mm256_storeu_pd(center_x + i, _mm256_div_pd(sx, four));
+    _mm256_storeu_pd(center_y + i, _mm256_div_pd(sy, four));
+  }
+  return i;
+}
+
+template <Scalar T>
+GEOMETRY_TARGET_SSE2 inline __m128d Load2(const T* p) {
+  if constexpr (std::is_same_v<T, double>) {
+    return _mm_loadu_pd(p);
+  } else if constexpr (std::is_same_v<T, float>) {
+    return _mm_cvtps_pd(
+        _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+  } else {
+    return _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+  }
+}
+
+GEOMETRY_TARGET_SSE2 inline __m128d Length2(__m128d dx, __m128d dy) {
+  return _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)));
+}
+
+template <AreaFormula F>
+GEOMETRY_TARGET_SSE2 inline __m128d Area2(const __m128d x[4], const __m128d y[4]) {
+  if constexpr (F == AreaFormula::SIDES) {
+    __m128d side1 = Length2(_mm_sub_pd(x[1], x[0]), _mm_sub_pd(y[1], y[0]));
+    __m128d side2 = Length2(_mm_sub_pd(x[2], x[1]), _mm_sub_pd(y[2], y[1]));
+    return _mm_mul_pd(side1, side2);
+  } else if constexpr (F == AreaFormula::DIAGONALS) {
+    __m128d d1 = Length2(_mm_sub_pd(x[2], x[0]), _mm_sub_pd(y[2], y[0]));
+    __m128d d2 = Length2(_mm_sub_pd(x[3], x[1]), _mm_sub_pd(y[3], y[1]));
+    return _mm_div_pd(_mm_mul_pd(d1, d2), _mm_set1_pd(2.0));
+  } else {
+    __m128d forward =
+        _mm_add_pd(_mm_add_pd(_mm_mul_pd(x[0], y[1]), _mm_mul_pd(x[1], y[2])),
+                   _mm_add_pd(_mm_mul_pd(x[2], y[3]), _mm_mul_pd(x[3], y[0])));
+    __m128d backward =
+        _mm_add_pd(_mm_add_pd(_mm_mul_pd(y[0], x[1]), _mm_mul_pd(y[1], x[2])),
+                   _mm_add_pd(_mm_mul_pd(y[2], x[3]), _mm_mul_pd(y[3], x[0])));
+    __m128d diff = _mm_andnot_pd(_mm_set1_pd(-0.0), _mm_sub_pd(forward, backward));
+    return _mm_mul_pd(_mm_set1_pd(0.5), diff);
+  }
+}
+
+template <Scalar T>
+GEOMETRY_TARGET_SSE2 inline void Load2(const VertexColumns<T>& columns, size_t i, __m128d x[4],
+                                       __m128d y[4]) {
+  for (size_t k = 0; k < VertexColumns<T>::VERTEX_COUNT; ++k) {
+    x[k] = Load2(columns.x[k] + i);
+    y[k] = Load2(columns.y[k] + i);
+  }
+}
+
+template <AreaFormula F, Scalar T>
+GEOMETRY_TARGET_SSE2 size_t AreasSse2(const VertexColumns<T>& columns, double* areas) {
+  __m128d x[4];
+  __m128d y[4];
+  size_t i = 0;
+  for (; i + 2 <= columns.size; i += 2) {
+    Load2(columns, i, x, y);
+    _mm_storeu_pd(areas + i, Area2<F>(x, y));
+  }
+  return i;
+}
+
+template <AreaFormula F, Scalar T>
+GEOMETRY_TARGET_SSE2 size_t TotalAreaSse2(const VertexColumns<T>& columns, double* total) {
+  __m128d x[4];
+  __m128d y[4];
+  __m128d sum = _mm_setzero_pd();
+  size_t i = 0;
+  for (; i + 2 <= columns.size; i += 2) {
+    Load2(columns, i, x, y);
+    sum = _mm_add_pd(sum, Area2<F>(x, y));
+  }
+  alignas(16) double lanes[2];
+  _mm_store_pd(lanes, sum);
+  *total = lanes[0] + lanes[1];
+  return i;
+}
+
+// `defect` in the lanes where `failed` is all ones, 0 elsewhere.
+GEOMETRY_TARGET_AVX2 inline __m256i DefectBits4(__m256d failed, uint8_t defect) {
+  return _mm256_and_si256(_mm256_castpd_si256(failed), _mm256_set1_epi64x(defect));
+}
+
+// Lane-wise ValidateQuadrilateral: the same operations in the same order, so every lane
+// matches the scalar result exactly. Each failed check ORs its bit into a 64-bit lane.
+template <ShapeKind KIND>
+GEOMETRY_TARGET_AVX2 inline __m256i Validate4(const __m256d x[4], const __m256d y[4],
+                                              double relative_tolerance) {
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d tolerance = _mm256_set1_pd(relative_tolerance);
+  const __m256d tolerance2 = _mm256_set1_pd(relative_tolerance * relative_tolerance);
+
+  __m256d finite = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+  // x - x is 0 for finite x and NaN for NaN and infinities.
+  for (size_t k = 0; k < 4; ++k) {
+    finite = _mm256_and_pd(finite, _mm256_cmp_pd(_mm256_sub_pd(x[k], x[k]), zero, _CMP_EQ_OQ));
+    finite = _mm256_and_pd(finite, _mm256_cmp_pd(_mm256_sub_pd(y[k], y[k]), zero, _CMP_EQ_OQ));
+  }
+
+  __m256d ex[4];
+  __m256d ey[4];
+  __m256d length2[4];
+  for (size_t k = 0; k < 4; ++k) {
+    size_t next = (k + 1) & 3;
+    ex[k] = _mm256_sub_pd(x[next], x[k]);
+    ey[k] = _mm256_sub_pd(y[next], y[k]);
+    length2[k] = _mm256_add_pd(_mm256_mul_pd(ex[k], ex[k]), _mm256_mul_pd(ey[k], ey[k]));
+  }
+  __m256d scale2 = _mm256_add_pd(_mm256_add_pd(length2[0], length2[1]),
+                                 _mm256_add_pd(length2[2], length2[3]));
+  __m256d degenerate_limit = _mm256_mul_pd(tolerance2, scale2);
+
+  const __m256d all_ones = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+  __m256i defects = _mm256_setzero_si256();
+  __m256d left = zero;
+  __m256d right = zero;
+  __m256d flat = zero;
+  for (size_t k = 0; k < 4; ++k) {
+    size_t next = (k + 1) & 3;
+    __m256d degenerate = _mm256_cmp_pd(length2[k], degenerate_limit, _CMP_LE_OQ);
+    defects = _mm256_or_si256(defects, DefectBits4(degenerate, ShapeDefect::DEGENERATE));
+    __m256d limit = _mm256_mul_pd(_mm256_mul_pd(tolerance2, length2[k]), length2[next]);
+    __m256d cross =
+        _mm256_sub_pd(_mm256_mul_pd(ex[k], ey[next]), _mm256_mul_pd(ey[k], ex[next]));
+    flat = _mm256_or_pd(flat, _mm256_cmp_pd(_mm256_mul_pd(cross, cross), limit, _CMP_LE_OQ));
+    left = _mm256_or_pd(left, _mm256_cmp_pd(cross, zero, _CMP_GT_OQ));
+    right = _mm256_or_pd(right, _mm256_cmp_pd(cross, zero, _CMP_LT_OQ));
+    if constexpr (KIND == ShapeKind::RECTANGLE) {
+      __m256d dot =
+          _mm256_add_pd(_mm256_mul_pd(ex[k], ex[next]), _mm256_mul_pd(ey[k], ey[next]));
+      __m256d oblique = _mm256_cmp_pd(_mm256_mul_pd(dot, dot), limit, _CMP_GT_OQ);
+      defects = _mm256_or_si256(defects, DefectBits4(oblique, ShapeDefect::NOT_RIGHT_ANGLED));
+    }
+    if constexpr (KIND == ShapeKind::RHOMBUS) {
+      __m256d difference = _mm256_andnot_pd(_mm256_set1_pd(-0.0),
+                                            _mm256_sub_pd(length2[next], length2[k]));
+      __m256d unequal =
+          _mm256_cmp_pd(difference, _mm256_mul_pd(tolerance, scale2), _CMP_GT_OQ);
+      defects = _mm256_or_si256(defects, DefectBits4(unequal, ShapeDefect::UNEQUAL_SIDES));
+    }
+  }
+  __m256d not_convex = _mm256_or_pd(flat, _mm256_and_pd(left, right));
+  defects = _mm256_or_si256(defects, DefectBits4(not_convex, ShapeDefect::NOT_CONVEX));
+
+  __m256d cross02 = _mm256_sub_pd(_mm256_mul_pd(ex[0], ey[2]), _mm256_mul_pd(ey[0], ex[2]));
+  __m256d cross13 = _mm256_sub_pd(_mm256_mul_pd(ex[1], ey[3]), _mm256_mul_pd(ey[1], ex[3]));
+  __m256d limit02 = _mm256_mul_pd(_mm256_mul_pd(tolerance2, length2[0]), length2[2]);
+  __m256d limit13 = _mm256_mul_pd(_mm256_mul_pd(tolerance2, length2[1]), length2[3]);
+  __m256d parallel02 = _mm256_cmp_pd(_mm256_mul_pd(cross02, cross02), limit02, _CMP_LE_OQ);
+  __m256d parallel13 = _mm256_cmp_pd(_mm256_mul_pd(cross13, cross13), limit13, _CMP_LE_OQ);
+  __m256d parallel = KIND == ShapeKind::TRAPEZOID ? _mm256_or_pd(parallel02, parallel13)
+                                                  : _mm256_and_pd(parallel02, parallel13);
+  __m256d not_parallel = _mm256_andnot_pd(parallel, all_ones);
+  defects = _mm256_or_si256(defects, DefectBits4(not_parallel, ShapeDefect::NOT_PARALLEL));
+
+  return _mm256_blendv_epi8(_mm256_set1_epi64x(ShapeDefect::NON_FINITE), defects,
+                            _mm256_castpd_si256(finite));
+}
+
+template <ShapeKind KIND, Scalar T>
+GEOMETRY_TARGET_AVX2 size_t ValidateAvx2(const VertexColumns<T>& columns, uint8_t* defects) {
+  __m256d x[4];
+  __m256d y[4];
+  alignas(32) uint64_t lanes[4];
+  size_t i = 0;
+  for (; i + 4 <= columns.size; i += 4) {
+    Load4(columns, i, x, y);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes),
+                       Validate4<KIND>(x, y, VALIDATION_TOLERANCE<T>));
+    for (size_t lane = 0; lane < 4; ++lane) {
+      defects[i + lane] = static_cast<uint8_t>(lanes[lane]);
+    }
+  }
+  return i;
+}
+
+template <Scalar T>
+GEOMETRY_TARGET_SSE2 size_t CentersSse2(const VertexColumns<T>& columns, double* center_x,
+                                        double* center_y) {
+  __m128d x[4];
+  __m128d y[4];
+  const __m128d four = _mm_set1_pd(4.0);
+  size_t i = 0;
+  for (; i + 2 <= columns.size; i += 2) {
+    Load2(columns, i, x, y);
+    __m128d sx = _mm_add_pd(_mm_add_pd(_mm_add_pd(x[0], x[1]), x[2]), x[3]);
+    __m128d sy = _mm_add_pd(_mm_add_pd(_mm_add_pd(y[0], y[1]), y[2]), y[3]);
+    _mm_storeu_pd(center_x + i, _mm_div_pd(sx, four));
+    _mm_storeu_pd(center_y + i, _mm_div_pd(sy, four));
+  }
+  return i;
+}
+
+#endif  // GEOMETRY_SIMD_X86
+
+}  // namespace kernels
+
+template <AreaFormula F, Scalar T>
+void BatchAreas(const VertexColumns<T>& columns, double* areas) {
+  size_t done = 0;
+#if GEOMETRY_SIMD_X86
+  if constexpr (kernels::HAS_VECTOR_LOAD<T>) {
+    switch (GetSimdLevel()) {
+      case SimdLevel::AVX2:
+        done = kernels::AreasAvx2<F>(columns, areas);
+        break;
+      case SimdLevel::SSE2:
+        done = kernels::AreasSse2<F>(columns, areas);
+        break;
+      case SimdLevel::SCALAR:
+        break;
+    }
+  }
+#endif
+  kernels::AreasScalar<F>(columns, areas, done);
+}
+
+template <AreaFormula F, Scalar T>
+double BatchTotalArea(const VertexColumns<T>& columns) {
+  size_t done = 0;
+  double total = 0.0;
+#if GEOMETRY_SIMD_X86
+  if constexpr (kernels::HAS_VECTOR_LOAD<T>) {
+    switch (GetSimdLevel()) {
+      case SimdLevel::AVX2:
+        done = kernels::TotalAreaAvx2<F>(columns, &total);
+        break;
+      case SimdLevel::SSE2:
+        done = kernels::TotalAreaSse2<F>(columns, &total);
+        break;
+      case SimdLevel::SCALAR:
+        break;
+    }
+  }
+#endif
+  return total + kernels::TotalAreaScalar<F>(columns, done);
+}
+
+template <Scalar T>
+void BatchCenters(const VertexColumns<T>& columns, double* center_x, double* center_y) {
+  size_t done = 0;
+#if GEOMETRY_SIMD_X86
+  if constexpr (kernels::HAS_VECTOR_LOAD<T>) {
+    switch (GetSimdLevel()) {
+      case SimdLevel::AVX2:
+        done = kernels::CentersAvx2(columns, center_x, center_y);
+        break;
+      case SimdLevel::SSE2:
+        done = kernels::CentersSse2(columns, center_x, center_y);
+        break;
+      case SimdLevel::SCALAR:
+        break;
+    }
+  }
+#endif
+  kernels::CentersScalar(columns, center_x, center_y, done);
+}
+
+template <ShapeKind KIND, Scalar T>
+void BatchValidate(const VertexColumns<T>& columns, uint8_t* defects) {
+  size_t done = 0;
+#if GEOMETRY_SIMD_X86
+  if constexpr (kernels::HAS_VECTOR_LOAD<T>) {
+    // AVX2 only; SSE2 machines take the scalar loop.
+    if (GetSimdLevel() == SimdLevel::AVX2) {
+      done = kernels::ValidateAvx2<KIND>(columns, defects);
+    }
+  }
+#endif
+  kernels::ValidateScalar<KIND>(columns, defects, done);
+}
+
+}  // namespace geometry
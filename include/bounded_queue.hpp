@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <semaphore>
+#include <vector>
+
+namespace geometry {
+
+// Fixed-capacity multi-producer multi-consumer FIFO. Push blocks while the queue is full and
+// Pop while it is empty; both wait on counting semaphores (futex-based atomic waits), and
+// the ring itself is guarded by a mutex held only for the slot update.
+template <typename T>
+class BoundedQueue {
+ public:
+  explicit BoundedQueue(size_t capacity);
+  BoundedQueue(const BoundedQueue&) = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+  // Returns false, leaving `value` untouched, once the queue is closed.
+  bool Push(T&& value);
+  // Returns std::nullopt once the queue is closed and drained.
+  std::optional<T> Pop();
+  // Wakes every blocked Push and Pop. Items already queued can still be popped.
+  void Close();
+
+  size_t Capacity() const;
+
+ private:
+  std::vector<std::optional<T>> slots_;
+  size_t head_;
+  size_t size_;
+  bool closed_;
+  std::mutex mutex_;
+  std::counting_semaphore<> free_slots_;
+  std::counting_semaphore<> filled_slots_;
+};
+
+}  // namespace geometry
+
+#include "bounded_queue.ipp"
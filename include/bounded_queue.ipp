@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdexcept>
+#include <utility>
+
+namespace geometry {
+
+template <typename T>
+BoundedQueue<T>::BoundedQueue(size_t capacity)
+    : slots_(capacity),
+      head_(0),
+      size_(0),
+      closed_(false),
+      free_slots_(static_cast<std::ptrdiff_t>(capacity)),
+      filled_slots_(0) {
+  if (capacity == 0) {
+    throw std::invalid_argument("Queue capacity must be positive");
+  }
+}
+
+template <typename T>
+bool BoundedQueue<T>::Push(T&& value) {
+  free_slots_.acquire();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!closed_) {
+      slots_[(head_ + size_) % slots_.size()].emplace(std::move(value));
+      ++size_;
+      filled_slots_.release();
+      return true;
+    }
+  }
+  // Pass the wake-up from Close on to the next blocked producer.
+  free_slots_.release();
+  return false;
+}
+
+template <typename T>
+std::optional<T> BoundedQueue<T>::Pop() {
+  filled_slots_.acquire();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (size_ > 0) {
+      std::optional<T> value(std::in_place, std::move(*slots_[head_]));
+      slots_[head_].reset();
+      head_ = (head_ + 1) % slots_.size();
+      --size_;
+      free_slots_.release();
+      return value;
+    }
+  }
+  // Empty and closed; pass the wake-up on to the next blocked consumer.
+  filled_slots_.release();
+  return std::nullopt;
+}
+
+template <typename T>
+void BoundedQueue<T>::Close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) {
+      return;
+    }
+    closed_ = true;
+  }
+  free_slots_.release();
+  filled_slots_.release();
+}
+
+template <typename T>
+size_t BoundedQueue<T>::Capacity() const {
+  return slots_.size();
+}
+
+}  // namespace geometry
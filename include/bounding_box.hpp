@@ -0,0 +1,37 @@
+#pragma once
+
+#include "point.hpp"
+
+namespace geometry {
+
+// Axis-aligned bounding box in double precision. Bounds are closed: boxes that only share
+// an edge or a corner intersect. The default box is empty and absorbs nothing.
+struct BoundingBox {
+  double min_x;
+  double min_y;
+  double max_x;
+  double max_y;
+
+  BoundingBox();
+  BoundingBox(double min_x, double min_y, double max_x, double max_y);
+
+  // Box of the figure's vertices.
+  template <typename Figure>
+  static BoundingBox Of(const Figure& figure);
+
+  bool IsEmpty() const;
+  double Width() const;
+  double Height() const;
+
+  bool Intersects(const BoundingBox& other) const;
+  bool Contains(double x, double y) const;
+
+  void Expand(double x, double y);
+  void Expand(const BoundingBox& other);
+
+  bool operator==(const BoundingBox& other) const = default;
+};
+
+}  // namespace geometry
+
+#include "bounding_box.ipp"
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+namespace geometry {
+
+inline BoundingBox::BoundingBox()
+    : min_x(std::numeric_limits<double>::infinity()),
+      min_y(std::numeric_limits<double>::infinity()),
+      max_x(-std::numeric_limits<double>::infinity()),
+      max_y(-std::numeric_limits<double>::infinity()) {
+}
+
+inline BoundingBox::BoundingBox(double min_x, double min_y, double max_x, double max_y)
+    : min_x(min_x), min_y(min_y), max_x(max_x), max_y(max_y) {
+}
+
+template <typename Figure>
+BoundingBox BoundingBox::Of(const Figure& figure) {
+  BoundingBox box;
+  for (size_t k = 0; k < figure.GetVertexCount(); ++k) {
+    const auto& vertex = figure.GetVertex(k);
+    box.Expand(static_cast<double>(vertex.x), static_cast<double>(vertex.y));
+  }
+  return box;
+}
+
+inline bool BoundingBox::IsEmpty() const {
+  return !(min_x <= max_x && min_y <= max_y);
+}
+
+inline double BoundingBox::Width() const {
+  return IsEmpty() ? 0.0 : max_x - min_x;
+}
+
+inline double BoundingBox::Height() const {
+  return IsEmpty() ? 0.0 : max_y - min_y;
+}
+
+inline bool BoundingBox::Intersects(const BoundingBox& other) const {
+  return min_x <= other.max_x && other.min_x <= max_x && min_y <= other.max_y &&
+         other.min_y <= max_y;
+}
+
+inline bool BoundingBox::Contains(double x, double y) const {
+  return min_x <= x && x <= max_x && min_y <= y && y <= max_y;
+}
+
+inline void BoundingBox::Expand(double x, double y) {
+  min_x = std::min(min_x, x);
+  min_y = std::min(min_y, y);
+  max_x = std::max(max_x, x);
+  max_y = std::max(max_y, y);
+}
+
+inline void BoundingBox::Expand(const BoundingBox& other) {
+  if (other.IsEmpty()) {
+    return;
+  }
+  Expand(other.min_x, other.min_y);
+  Expand(other.max_x, other.max_y);
+}
+
+}  // namespace geometry
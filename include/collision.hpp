@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "bounding_box.hpp"
+#include "figure_vector.hpp"
+#include "thread_pool.hpp"
+
+namespace geometry {
+
+// Pair of element indices with first < second.
+using IndexPair = std::pair<size_t, size_t>;
+
+template <typename Figure>
+std::vector<BoundingBox> ComputeBoundingBoxes(const FigureArray<Figure>& figures);
+template <typename Figure>
+std::vector<BoundingBox> ComputeBoundingBoxes(const FigureArray<Figure>& figures,
+                                              ThreadPool& pool);
+
+// Sweep-and-prune broad phase: every pair of boxes that intersect (closed bounds), sorted.
+// Boxes are bucketed into horizontal strips; within a strip they are sorted by min_x and
+// each box is compared only with the boxes that start before it ends on x. Empty boxes,
+// including boxes with NaN bounds, never pair.
+std::vector<IndexPair> BroadPhasePairs(const std::vector<BoundingBox>& boxes);
+// Same result; strips are sorted and swept in parallel.
+std::vector<IndexPair> BroadPhasePairs(const std::vector<BoundingBox>& boxes, ThreadPool& pool);
+
+// Separating axis test for two convex polygons given by their vertices in order (either
+// winding). Polygons that only touch overlap.
+template <typename FigureA, typename FigureB>
+bool Overlaps(const FigureA& a, const FigureB& b);
+
+// All overlapping pairs: broad phase on bounding boxes, then Overlaps on each candidate.
+template <typename Figure>
+std::vector<IndexPair> FindOverlaps(const FigureArray<Figure>& figures);
+template <typename Figure>
+std::vector<IndexPair> FindOverlaps(const FigureArray<Figure>& figures, ThreadPool& pool);
+
+}  // namespace geometry
+
+#include "collision.ipp"
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace geometry {
+
+namespace collision {
+
+// Chunk length of the parallel passes, in boxes or candidate pairs.
+constexpr size_t PARALLEL_CHUNK_SIZE = 4096;
+
+struct SweepEntry {
+  BoundingBox box;
+  size_t index;
+};
+
+// Boxes bucketed into horizontal strips about two mean box heights tall; a box is copied
+// into every strip it touches. Strip s holds entries[offsets[s], offsets[s + 1]).
+// Sweeping each strip separately keeps the x-sweep from comparing boxes that are far
+// apart on y, which a single sweep over a large square scene does ~sqrt(n) times per box.
+struct SweepStrips {
+  std::vector<SweepEntry> entries;
+  std::vector<size_t> offsets;
+  double min_y = 0.0;
+  double height = 1.0;
+  size_t count = 1;
+
+  size_t StripOf(double y) const {
+    double strip = (y - min_y) / height;
+    if (!(strip >= 1.0)) {
+      return 0;
+    }
+    return strip >= static_cast<double>(count) ? count - 1 : static_cast<size_t>(strip);
+  }
+};
+
+inline SweepStrips BuildStrips(const std::vector<BoundingBox>& boxes) {
+  SweepStrips strips;
+  BoundingBox bounds;
+  double total_height = 0.0;
+  size_t non_empty = 0;
+  for (const BoundingBox& box : boxes) {
+    if (!box.IsEmpty()) {
+      bounds.Expand(box);
+      total_height += box.Height();
+      ++non_empty;
+    }
+  }
+  // Infinite extents fall back to a single strip.
+  if (non_empty > 0 && bounds.Height() > 0.0 && total_height > 0.0 &&
+      std::isfinite(bounds.Height()) && std::isfinite(total_height)) {
+    double height = 2.0 * total_height / static_cast<double>(non_empty);
+    double count = std::min(std::ceil(bounds.Height() / height), static_cast<double>(non_empty));
+    strips.count = static_cast<size_t>(std::max(count, 1.0));
+    strips.min_y = bounds.min_y;
+    strips.height = bounds.Height() / static_cast<double>(strips.count);
+  }
+
+  strips.offsets.assign(strips.count + 1, 0);
+  for (const BoundingBox& box : boxes) {
+    if (!box.IsEmpty()) {
+      for (size_t s = strips.StripOf(box.min_y); s <= strips.StripOf(box.max_y); ++s) {
+        ++strips.offsets[s + 1];
+      }
+    }
+  }
+  for (size_t s = 0; s < strips.count; ++s) {
+    strips.offsets[s + 1] += strips.offsets[s];
+  }
+  strips.entries.resize(strips.offsets.back());
+  std::vector<size_t> cursor(strips.offsets.begin(), strips.offsets.end() - 1);
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    if (!boxes[i].IsEmpty()) {
+      for (size_t s = strips.StripOf(boxes[i].min_y); s <= strips.StripOf(boxes[i].max_y); ++s) {
+        strips.entries[cursor[s]++] = {boxes[i], i};
+      }
+    }
+  }
+  return strips;
+}
+
+// Sorts strip `strip` by min_x and sweeps it. A pair sharing several strips is reported
+// only by the strip holding the bottom of their overlap.
+inline void SweepStrip(SweepStrips& strips, size_t strip, std::vector<IndexPair>& pairs) {
+  auto first = strips.entries.begin() + static_cast<std::ptrdiff_t>(strips.offsets[strip]);
+  auto last = strips.entries.begin() + static_cast<std::ptrdiff_t>(strips.offsets[strip + 1]);
+  std::sort(first, last, [](const SweepEntry& lhs, const SweepEntry& rhs) {
+    return lhs.box.min_x < rhs.box.min_x ||
+           (lhs.box.min_x == rhs.box.min_x && lhs.index < rhs.index);
+  });
+  for (auto it = first; it != last; ++it) {
+    const BoundingBox& box = it->box;
+    for (auto other = it + 1; other != last && other->box.min_x <= box.max_x; ++other) {
+      if (box.min_y <= other->box.max_y && other->box.min_y <= box.max_y &&
+          strips.StripOf(std::max(box.min_y, other->box.min_y)) == strip) {
+        pairs.emplace_back(std::min(it->index, other->index), std::max(it->index, other->index));
+      }
+    }
+  }
+}
+
+inline size_t ChunkCount(size_t size) {
+  return (size + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+}
+
+template <typename Figure>
+double Project(const Figure& figure, double axis_x, double axis_y, double* max) {
+  double min = std::numeric_limits<double>::infinity();
+  *max = -std::numeric_limits<double>::infinity();
+  for (size_t k = 0; k < figure.GetVertexCount(); ++k) {
+    const auto& vertex = figure.GetVertex(k);
+    double projection =
+        axis_x * static_cast<double>(vertex.x) + axis_y * static_cast<double>(vertex.y);
+    min = std::min(min, projection);
+    *max = std::max(*max, projection);
+  }
+  return min;
+}
+
+// True if one of `edges_of`'s edge normals separates the two polygons.
+template <typename FigureA, typename FigureB>
+bool HasSeparatingAxis(const FigureA& edges_of, const FigureB& other) {
+  size_t count = edges_of.GetVertexCount();
+  for (size_t k = 0; k < count; ++k) {
+    const auto& from = edges_of.GetVertex(k);
+    const auto& to = edges_of.GetVertex((k + 1) % count);
+    double axis_x = static_cast<double>(from.y) - static_cast<double>(to.y);
+    double axis_y = static_cast<double>(to.x) - static_cast<double>(from.x);
+    double max_a;
+    double max_b;
+    double min_a = Project(edges_of, axis_x, axis_y, &max_a);
+    double min_b = Project(other, axis_x, axis_y, &max_b);
+    if (max_a < min_b || max_b < min_a) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace collision
+
+template <typename Figure>
+std::vector<BoundingBox> ComputeBoundingBoxes(const FigureArray<Figure>& figures) {
+  std::vector<BoundingBox> boxes(figures.Size());
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    boxes[i] = BoundingBox::Of(figures[i]);
+  }
+  return boxes;
+}
+
+template <typename Figure>
+std::vector<BoundingBox> ComputeBoundingBoxes(const FigureArray<Figure>& figures,
+                                              ThreadPool& pool) {
+  std::vector<BoundingBox> boxes(figures.Size());
+  pool.ParallelFor(collision::ChunkCount(figures.Size()), [&](size_t chunk) {
+    size_t begin = chunk * collision::PARALLEL_CHUNK_SIZE;
+    size_t end = std::min(begin + collision::PARALLEL_CHUNK_SIZE, figures.Size());
+    for (size_t i = begin; i < end; ++i) {
+      boxes[i] = BoundingBox::Of(figures[i]);
+    }
+  });
+  return boxes;
+}
+
+inline std::vector<IndexPair> BroadPhasePairs(const std::vector<BoundingBox>& boxes) {
+  collision::SweepStrips strips = collision::BuildStrips(boxes);
+  std::vector<IndexPair> pairs;
+  for (size_t s = 0; s < strips.count; ++s) {
+    collision::SweepStrip(strips, s, pairs);
+  }
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+inline std::vector<IndexPair> BroadPhasePairs(const std::vector<BoundingBox>& boxes,
+                                              ThreadPool& pool) {
+  collision::SweepStrips strips = collision::BuildStrips(boxes);
+  std::vector<std::vector<IndexPair>> partial(strips.count);
+  pool.ParallelFor(strips.count,
+                   [&](size_t strip) { collision::SweepStrip(strips, strip, partial[strip]); });
+
+  size_t total = 0;
+  for (const std::vector<IndexPair>& strip_pairs : partial) {
+    total += strip_pairs.size();
+  }
+  std::vector<IndexPair> pairs;
+  pairs.reserve(total);
+  for (const std::vector<IndexPair>& strip_pairs : partial) {
+    pairs.insert(pairs.end(), strip_pairs.begin(), strip_pairs.end());
+  }
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+template <typename FigureA, typename FigureB>
+bool Overlaps(const FigureA& a, const FigureB& b) {
+  return !collision::HasSeparatingAxis(a, b) && !collision::HasSeparatingAxis(b, a);
+}
+
+template <typename Figure>
+std::vector<IndexPair> FindOverlaps(const FigureArray<Figure>& figures) {
+  std::vector<IndexPair> candidates = BroadPhasePairs(ComputeBoundingBoxes(figures));
+  std::erase_if(candidates, [&](const IndexPair& pair) {
+    return !Overlaps(figures[pair.first], figures[pair.second]);
+  });
+  return candidates;
+}
+
+template <typename Figure>
+std::vector<IndexPair> FindOverlaps(const FigureArray<Figure>& figures, ThreadPool& pool) {
+  std::vector<IndexPair> candidates = BroadPhasePairs(ComputeBoundingBoxes(figures, pool), pool);
+  std::vector<uint8_t> overlapping(candidates.size());
+  pool.ParallelFor(collision::ChunkCount(candidates.size()), [&](size_t chunk) {
+    size_t begin = chunk * collision::PARALLEL_CHUNK_SIZE;
+    size_t end = std::min(begin + collision::PARALLEL_CHUNK_SIZE, candidates.size());
+    for (size_t i = begin; i < end; ++i) {
+      overlapping[i] = Overlaps(figures[candidates[i].first], figures[candidates[i].second]);
+    }
+  });
+
+  size_t kept = 0;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (overlapping[i]) {
+      candidates[kept++] = candidates[i];
+    }
+  }
+  candidates.resize(kept);
+  return candidates;
+}
+
+}  // namespace geometry
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+#include "figure_vector.hpp"
+
+namespace geometry {
+
+// Append-only array for many producer threads. Every producer appends to its own shard, so
+// appends take no lock and never contend. A shard is a list of segments of doubling
+// capacity; growing adds a segment and never moves existing elements, so references stay
+// valid until Merge or destruction.
+//
+// Lifecycle: create producers (thread-safe), append from any number of threads (one
+// thread per producer at a time), then, once every append has returned and is visible to
+// the calling thread (e.g. after joining the producers), either Freeze() for indexed
+// read-only access or Merge() into a regular FigureArray.
+template <typename T>
+class ConcurrentFigureArray {
+  struct Shard;
+
+ public:
+  // Handle to one shard. Cheap to copy; valid for the lifetime of the array.
+  class Producer {
+   public:
+    void PushBack(const T& value);
+    void PushBack(T&& value);
+    // Throws std::logic_error if the array is frozen.
+    template <typename... Args>
+    const T& EmplaceBack(Args&&... args);
+
+    size_t Size() const;
+
+   private:
+    friend class ConcurrentFigureArray;
+    Producer(ConcurrentFigureArray* owner, Shard* shard);
+
+    ConcurrentFigureArray* owner_;
+    Shard* shard_;
+  };
+
+  ConcurrentFigureArray();
+  // Segments are allocated from `resource`, which must outlive the array. Allocation is
+  // serialized internally, so the resource need not be thread-safe.
+  explicit ConcurrentFigureArray(std::pmr::memory_resource* resource);
+  ConcurrentFigureArray(const ConcurrentFigureArray&) = delete;
+  ConcurrentFigureArray& operator=(const ConcurrentFigureArray&) = delete;
+  ~ConcurrentFigureArray();
+
+  Producer CreateProducer();
+  size_t ProducerCount() const;
+
+  // Safe to call while producers append; counts every append that has completed.
+  size_t Size() const;
+  bool Empty() const;
+
+  // Stops appends and enables operator[]. Elements are ordered by producer creation, then
+  // by append order within each producer.
+  void Freeze();
+  bool IsFrozen() const;
+  // Requires Freeze(); throws std::logic_error otherwise.
+  const T& operator[](size_t index) const;
+
+  // Calls visitor(element) in the same order as operator[] for every completed append.
+  // May run while producers append, but holds the lock that segment growth takes.
+  template <typename Visitor>
+  void ForEach(Visitor&& visitor) const;
+  double GetTotalArea() const requires HasArea<T>;
+
+  // Moves every element, in operator[] order, into a FigureArray that uses the same memory
+  // resource, then empties the shards and lifts the freeze. Producers stay usable for the
+  // next round. Producers must be idle.
+  FigureArray<T> Merge();
+
+ private:
+  static constexpr size_t FIRST_SEGMENT_CAPACITY = 256;
+
+  // Aligned to a cache line so neighbouring shards' counters do not share one.
+  struct alignas(64) Shard {
+    std::vector<T*> segments;
+    std::atomic<size_t> size{0};
+  };
+
+  static size_t SegmentOf(size_t index);
+  static size_t SegmentCapacity(size_t segment);
+  static size_t SegmentStart(size_t segment);
+  static T* Slot(const Shard& shard, size_t index);
+
+  void AddSegment(Shard& shard);
+  void ReleaseShard(Shard& shard);
+
+  std::pmr::memory_resource* resource_;
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<bool> frozen_;
+  std::vector<size_t> offsets_;
+};
+
+}  // namespace geometry
+
+#include "concurrent_figure_array.ipp"
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "summation.hpp"
+
+namespace geometry {
+
+template <typename T>
+ConcurrentFigureArray<T>::Producer::Producer(ConcurrentFigureArray* owner, Shard* shard)
+    : owner_(owner), shard_(shard) {
+}
+
+template <typename T>
+void ConcurrentFigureArray<T>::Producer::PushBack(const T& value) {
+  EmplaceBack(value);
+}
+
+template <typename T>
+void ConcurrentFigureArray<T>::Producer::PushBack(T&& value) {
+  EmplaceBack(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+const T& ConcurrentFigureArray<T>::Producer::EmplaceBack(Args&&... args) {
+  if (owner_->frozen_.load(std::memory_order_relaxed)) {
+    throw std::logic_error("ConcurrentFigureArray is frozen");
+  }
+  // Only this producer writes the shard, so a relaxed read of its own counter is exact.
+  size_t index = shard_->size.load(std::memory_order_relaxed);
+  if (SegmentOf(index) == shard_->segments.size()) {
+    owner_->AddSegment(*shard_);
+  }
+  T* slot = Slot(*shard_, index);
+  ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+  shard_->size.store(index + 1, std::memory_order_release);
+  return *slot;
+}
+
+template <typename T>
+size_t ConcurrentFigureArray<T>::Producer::Size() const {
+  return shard_->size.load(std::memory_order_acquire);
+}
+
+template <typename T>
+ConcurrentFigureArray<T>::ConcurrentFigureArray()
+    : ConcurrentFigureArray(std::pmr::get_default_resource()) {
+}
+
+template <typename T>
+ConcurrentFigureArray<T>::ConcurrentFigureArray(std::pmr::memory_resource* resource)
+    : resource_(resource), frozen_(false) {
+  if (resource_ == nullptr) {
+    throw std::invalid_argument("Memory resource must not be null");
+  }
+}
+
+template <typename T>
+ConcurrentFigureArray<T>::~ConcurrentFigureArray() {
+  for (std::unique_ptr<Shard>& shard : shards_) {
+    ReleaseShard(*shard);
+  }
+}
+
+template <typename T>
+typename ConcurrentFigureArray<T>::Producer ConcurrentFigureArray<T>::CreateProducer() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (frozen_.load(std::memory_order_relaxed)) {
+    throw std::logic_error("ConcurrentFigureArray is frozen");
+  }
+  shards_.push_back(std::make_unique<Shard>());
+  return Producer(this, shards_.back().get());
+}
+
+template <typename T>
+size_t ConcurrentFigureArray<T>::ProducerCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return shards_.size();
+}
+
+template <typename T>
+size_t ConcurrentFigureArray<T>::Size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t total = 0;
+  for (const std::unique_ptr<Shard>& shard : shards_) {
+    total += shard->size.load(std::memory_order_acquire);
+  }
+  return total;
+}
+
+template <typename T>
+bool ConcurrentFigureArray<T>::Empty() const {
+  return Size() == 0;
+}
+
+template <typename T>
+void ConcurrentFigureArray<T>::Freeze() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  frozen_.store(true, std::memory_order_relaxed);
+  offsets_.assign(1, 0);
+  for (const std::unique_ptr<Shard>& shard : shards_) {
+    offsets_.push_back(offsets_.back() + shard->size.load(std::memory_order_acquire));
+  }
+}
+
+template <typename T>
+bool ConcurrentFigureArray<T>::IsFrozen() const {
+  return frozen_.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+const T& ConcurrentFigureArray<T>::operator[](size_t index) const {
+  if (!IsFrozen()) {
+    throw std::logic_error("ConcurrentFigureArray must be frozen before indexed access");
+  }
+  if (index >= offsets_.back()) {
+    throw std::out_of_range("Index out of range");
+  }
+  // offsets_ is non-decreasing; the owning shard is the last one starting at or before index.
+  size_t shard = static_cast<size_t>(
+      std::upper_bound(offsets_.begin(), offsets_.end(), index) - offsets_.begin() - 1);
+  return *Slot(*shards_[shard], index - offsets_[shard]);
+}
+
+template <typename T>
+template <typename Visitor>
+void ConcurrentFigureArray<T>::ForEach(Visitor&& visitor) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const std::unique_ptr<Shard>& shard : shards_) {
+    size_t size = shard->size.load(std::memory_order_acquire);
+    for (size_t segment = 0; segment < shard->segments.size(); ++segment) {
+      size_t start = SegmentStart(segment);
+      if (start >= size) {
+        break;
+      }
+      const T* data = shard->segments[segment];
+      size_t count = std::min(SegmentCapacity(segment), size - start);
+      for (size_t i = 0; i < count; ++i) {
+        visitor(data[i]);
+      }
+    }
+  }
+}
+
+template <typename T>
+double ConcurrentFigureArray<T>::GetTotalArea() const requires HasArea<T> {
+  KahanAccumulator total;
+  ForEach([&](const T& figure) { total.Add(static_cast<double>(figure)); });
+  return total.Sum();
+}
+
+template <typename T>
+FigureArray<T> ConcurrentFigureArray<T>::Merge() {
+  FigureArray<T> merged(resource_);
+  merged.Reserve(Size());
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::unique_ptr<Shard>& shard : shards_) {
+      size_t size = shard->size.load(std::memory_order_acquire);
+      for (size_t i = 0; i < size; ++i) {
+        merged.PushBack(std::move(*Slot(*shard, i)));
+      }
+      ReleaseShard(*shard);
+    }
+    offsets_.clear();
+    frozen_.store(false, std::memory_order_relaxed);
+  }
+  return merged;
+}
+
+template <typename T>
+size_t ConcurrentFigureArray<T>::SegmentOf(size_t index) {
+  return static_cast<size_t>(std::bit_width(index / FIRST_SEGMENT_CAPACITY + 1)) - 1;
+}
+
+template <typename T>
+size_t ConcurrentFigureArray<T>::SegmentCapacity(size_t segment) {
+  return FIRST_SEGMENT_CAPACITY << segment;
+}
+
+template <typename T>
+size_t ConcurrentFigureArray<T>::SegmentStart(size_t segment) {
+  return FIRST_SEGMENT_CAPACITY * ((size_t{1} << segment) - 1);
+}
+
+template <typename T>
+T* ConcurrentFigureArray<T>::Slot(const Shard& shard, size_t index) {
+  size_t segment = SegmentOf(index);
+  return shard.segments[segment] + (index - SegmentStart(segment));
+}
+
+template <typename T>
+void ConcurrentFigureArray<T>::AddSegment(Shard& shard) {
+  // The segment list changes under the lock so ForEach and Freeze can read it while
+  // producers append.
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t capacity = SegmentCapacity(shard.segments.size());
+  shard.segments.push_back(static_cast<T*>(resource_->allocate(capacity * sizeof(T), alignof(T))));
+}
+
+template <typename T>
+void ConcurrentFigureArray<T>::ReleaseShard(Shard& shard) {
+  size_t size = shard.size.load(std::memory_order_relaxed);
+  for (size_t segment = 0; segment < shard.segments.size(); ++segment) {
+    T* data = shard.segments[segment];
+    size_t start = SegmentStart(segment);
+    size_t count = start < size ? std::min(SegmentCapacity(segment), size - start) : 0;
+    std::destroy_n(data, count);
+    resource_->deallocate(data, SegmentCapacity(segment) * sizeof(T), alignof(T));
+  }
+  shard.segments.clear();
+  shard.size.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace geometry
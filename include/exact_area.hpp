@@ -0,0 +1,26 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+
+#include "point.hpp"
+
+namespace geometry {
+
+// Signed 128-bit integer (GCC/Clang builtin) for exact integer geometry.
+__extension__ typedef __int128 Int128;
+
+// Twice the signed area of the quadrilateral vertices[0..3], positive for counter-clockwise
+// order. Uses the cross product of the diagonals, which equals the shoelace sum, so no
+// square roots and no intermediate overflow: exact for every integral T of up to 32 bits
+// and for 64-bit coordinates below 2^62 in magnitude.
+template <std::integral T>
+constexpr Int128 TwiceSignedArea(const Point<T>* vertices);
+
+// Nearest double to `value`; values that fit in int64_t take the one-instruction
+// conversion instead of the 128-bit library routine.
+double ToDouble(Int128 value);
+
+}  // namespace geometry
+
+#include "exact_area.ipp"
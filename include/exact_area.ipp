@@ -0,0 +1,31 @@
+#pragma once
+
+namespace geometry {
+
+template <std::integral T>
+constexpr Int128 TwiceSignedArea(const Point<T>* vertices) {
+  if constexpr (sizeof(T) < sizeof(int64_t)) {
+    // Differences fit in int64_t, so each product is a single 64x64->128 multiply.
+    int64_t dx1 = static_cast<int64_t>(vertices[2].x) - static_cast<int64_t>(vertices[0].x);
+    int64_t dy1 = static_cast<int64_t>(vertices[2].y) - static_cast<int64_t>(vertices[0].y);
+    int64_t dx2 = static_cast<int64_t>(vertices[3].x) - static_cast<int64_t>(vertices[1].x);
+    int64_t dy2 = static_cast<int64_t>(vertices[3].y) - static_cast<int64_t>(vertices[1].y);
+    return static_cast<Int128>(dx1) * dy2 - static_cast<Int128>(dy1) * dx2;
+  } else {
+    Int128 dx1 = static_cast<Int128>(vertices[2].x) - static_cast<Int128>(vertices[0].x);
+    Int128 dy1 = static_cast<Int128>(vertices[2].y) - static_cast<Int128>(vertices[0].y);
+    Int128 dx2 = static_cast<Int128>(vertices[3].x) - static_cast<Int128>(vertices[1].x);
+    Int128 dy2 = static_cast<Int128>(vertices[3].y) - static_cast<Int128>(vertices[1].y);
+    return dx1 * dy2 - dy1 * dx2;
+  }
+}
+
+inline double ToDouble(Int128 value) {
+  int64_t narrow = static_cast<int64_t>(value);
+  if (narrow == value) {
+    return static_cast<double>(narrow);
+  }
+  return static_cast<double>(value);
+}
+
+}  // namespace geometry
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <cstddef>
-#include <memory>
 
 #include "point.hpp"
 
@@ -14,19 +13,31 @@ class Figure {
   virtual ~Figure() = default;
 
   virtual size_t GetVertexCount() const = 0;
+  virtual const Point<T>& GetVertex(size_t index) const = 0;
+  // Shapes compute area, center and perimeter on first use and cache them until a vertex
+  // changes (see ShapeCache); these const calls may run concurrently on one shape.
   virtual Point<T> GetCenter() const = 0;
+  virtual double GetPerimeter() const = 0;
   virtual operator double() const = 0;
 
  protected:
-  static Point<T> CalculateCenter(const std::unique_ptr<Point<T>>* points, size_t count) {
+  static Point<T> CalculateCenter(const Point<T>* points, size_t count) {
     double sum_x = 0.0;
     double sum_y = 0.0;
     for (size_t i = 0; i < count; ++i) {
-      sum_x += static_cast<double>(points[i]->x);
-      sum_y += static_cast<double>(points[i]->y);
+      sum_x += static_cast<double>(points[i].x);
+      sum_y += static_cast<double>(points[i].y);
     }
     return Point<T>(static_cast<T>(sum_x / count), static_cast<T>(sum_y / count));
   }
+
+  static double CalculatePerimeter(const Point<T>* points, size_t count) {
+    double perimeter = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+      perimeter += points[i].DistanceTo(points[(i + 1) % count]);
+    }
+    return perimeter;
+  }
 };
 
 }  // namespace geometry
\ No newline at end of file
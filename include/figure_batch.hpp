@@ -0,0 +1,85 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "batch_kernels.hpp"
+#include "figure_vector.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+#include "shape_kind.hpp"
+#include "trapezoid.hpp"
+
+namespace geometry {
+
+template <template <typename> class Shape>
+struct ShapeTraits;
+
+template <>
+struct ShapeTraits<Rectangle> {
+  static constexpr AreaFormula AREA = AreaFormula::SIDES;
+  static constexpr ShapeKind KIND = ShapeKind::RECTANGLE;
+};
+
+template <>
+struct ShapeTraits<Rhombus> {
+  static constexpr AreaFormula AREA = AreaFormula::DIAGONALS;
+  static constexpr ShapeKind KIND = ShapeKind::RHOMBUS;
+};
+
+template <>
+struct ShapeTraits<Trapezoid> {
+  static constexpr AreaFormula AREA = AreaFormula::SHOELACE;
+  static constexpr ShapeKind KIND = ShapeKind::TRAPEZOID;
+};
+
+// Structure-of-arrays storage for many shapes of one type: one x and one y column per
+// vertex slot, so the area/center kernels stream over contiguous coordinates.
+// Integer shapes take their area from exact cross products (exact_area.hpp), which is the
+// shoelace formula whatever the shape.
+template <Scalar T, template <typename> class Shape>
+inline constexpr AreaFormula AREA_FORMULA =
+    std::integral<T> ? AreaFormula::SHOELACE : ShapeTraits<Shape>::AREA;
+
+template <Scalar T, template <typename> class Shape>
+class FigureBatch {
+ public:
+  static constexpr size_t VERTEX_COUNT = VertexColumns<T>::VERTEX_COUNT;
+
+  FigureBatch() = default;
+  explicit FigureBatch(const FigureArray<Shape<T>>& figures);
+
+  void PushBack(const Shape<T>& figure);
+  void Reserve(size_t new_capacity);
+  void Clear();
+
+  size_t Size() const;
+  bool Empty() const;
+
+  Shape<T> operator[](size_t index) const;
+
+  const T* X(size_t vertex) const;
+  const T* Y(size_t vertex) const;
+  VertexColumns<T> Columns() const;
+
+  void ComputeAreas(double* areas) const;
+  void ComputeCenters(double* center_x, double* center_y) const;
+  double GetTotalArea() const;
+  // defects[i] = (*this)[i].Validate().
+  void Validate(uint8_t* defects) const;
+
+ private:
+  std::vector<T> x_[VERTEX_COUNT];
+  std::vector<T> y_[VERTEX_COUNT];
+};
+
+// One ShapeDefect mask per figure, equal to figures[i].Validate(). Vertices are copied into
+// columns a block at a time so the checks run through the BatchValidate kernels.
+template <Scalar T, template <typename> class Shape>
+std::vector<uint8_t> ValidateAll(const FigureArray<Shape<T>>& figures);
+
+}  // namespace geometry
+
+#include "figure_batch.ipp"
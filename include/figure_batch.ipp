@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace geometry {
+
+template <Scalar T, template <typename> class Shape>
+FigureBatch<T, Shape>::FigureBatch(const FigureArray<Shape<T>>& figures) {
+  Reserve(figures.Size());
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    PushBack(figures[i]);
+  }
+}
+
+template <Scalar T, template <typename> class Shape>
+void FigureBatch<T, Shape>::PushBack(const Shape<T>& figure) {
+  for (size_t k = 0; k < VERTEX_COUNT; ++k) {
+    const Point<T>& vertex = figure.GetVertex(k);
+    x_[k].push_back(vertex.x);
+    y_[k].push_back(vertex.y);
+  }
+}
+
+template <Scalar T, template <typename> class Shape>
+void FigureBatch<T, Shape>::Reserve(size_t new_capacity) {
+  for (size_t k = 0; k < VERTEX_COUNT; ++k) {
+    x_[k].reserve(new_capacity);
+    y_[k].reserve(new_capacity);
+  }
+}
+
+template <Scalar T, template <typename> class Shape>
+void FigureBatch<T, Shape>::Clear() {
+  for (size_t k = 0; k < VERTEX_COUNT; ++k) {
+    x_[k].clear();
+    y_[k].clear();
+  }
+}
+
+template <Scalar T, template <typename> class Shape>
+size_t FigureBatch<T, Shape>::Size() const {
+  return x_[0].size();
+}
+
+template <Scalar T, template <typename> class Shape>
+bool FigureBatch<T, Shape>::Empty() const {
+  return x_[0].empty();
+}
+
+template <Scalar T, template <typename> class Shape>
+Shape<T> FigureBatch<T, Shape>::operator[](size_t index) const {
+  if (index >= Size()) {
+    throw std::out_of_range("Index out of range");
+  }
+  return Shape<T>(Point<T>(x_[0][index], y_[0][index]), Point<T>(x_[1][index], y_[1][index]),
+                  Point<T>(x_[2][index], y_[2][index]), Point<T>(x_[3][index], y_[3][index]));
+}
+
+template <Scalar T, template <typename> class Shape>
+const T* FigureBatch<T, Shape>::X(size_t vertex) const {
+  if (vertex >= VERTEX_COUNT) {
+    throw std::out_of_range("Vertex index out of range");
+  }
+  return x_[vertex].data();
+}
+
+template <Scalar T, template <typename> class Shape>
+const T* FigureBatch<T, Shape>::Y(size_t vertex) const {
+  if (vertex >= VERTEX_COUNT) {
+    throw std::out_of_range("Vertex index out of range");
+  }
+  return y_[vertex].data();
+}
+
+template <Scalar T, template <typename> class Shape>
+VertexColumns<T> FigureBatch<T, Shape>::Columns() const {
+  VertexColumns<T> columns;
+  for (size_t k = 0; k < VERTEX_COUNT; ++k) {
+    columns.x[k] = x_[k].data();
+    columns.y[k] = y_[k].data();
+  }
+  columns.size = Size();
+  return columns;
+}
+
+template <Scalar T, template <typename> class Shape>
+void FigureBatch<T, Shape>::ComputeAreas(double* areas) const {
+  BatchAreas<AREA_FORMULA<T, Shape>>(Columns(), areas);
+}
+
+template <Scalar T, template <typename> class Shape>
+void FigureBatch<T, Shape>::ComputeCenters(double* center_x, double* center_y) const {
+  BatchCenters(Columns(), center_x, center_y);
+}
+
+template <Scalar T, template <typename> class Shape>
+double FigureBatch<T, Shape>::GetTotalArea() const {
+  return BatchTotalArea<AREA_FORMULA<T, Shape>>(Columns());
+}
+
+template <Scalar T, template <typename> class Shape>
+void FigureBatch<T, Shape>::Validate(uint8_t* defects) const {
+  BatchValidate<ShapeTraits<Shape>::KIND>(Columns(), defects);
+}
+
+template <Scalar T, template <typename> class Shape>
+std::vector<uint8_t> ValidateAll(const FigureArray<Shape<T>>& figures) {
+  constexpr size_t BLOCK_SIZE = 512;
+  constexpr size_t VERTEX_COUNT = VertexColumns<T>::VERTEX_COUNT;
+  std::vector<uint8_t> defects(figures.Size());
+  std::vector<T> block(2 * VERTEX_COUNT * BLOCK_SIZE);
+  VertexColumns<T> columns;
+  for (size_t k = 0; k < VERTEX_COUNT; ++k) {
+    columns.x[k] = block.data() + (2 * k) * BLOCK_SIZE;
+    columns.y[k] = block.data() + (2 * k + 1) * BLOCK_SIZE;
+  }
+
+  for (size_t begin = 0; begin < figures.Size(); begin += BLOCK_SIZE) {
+    columns.size = std::min(BLOCK_SIZE, figures.Size() - begin);
+    for (size_t i = 0; i < columns.size; ++i) {
+      const Shape<T>& figure = figures[begin + i];
+      for (size_t k = 0; k < VERTEX_COUNT; ++k) {
+        const Point<T>& vertex = figure.GetVertex(k);
+        block[(2 * k) * BLOCK_SIZE + i] = vertex.x;
+        block[(2 * k + 1) * BLOCK_SIZE + i] = vertex.y;
+      }
+    }
+    BatchValidate<ShapeTraits<Shape>::KIND>(columns, defects.data() + begin);
+  }
+  return defects;
+}
+
+}  // namespace geometry
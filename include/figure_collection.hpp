@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <ostream>
+#include <tuple>
+#include <vector>
+
+#include "figure_vector.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+#include "trapezoid.hpp"
+
+namespace geometry {
+
+template <typename Shape, typename... Shapes>
+concept OneOf = (std::same_as<Shape, Shapes> || ...);
+
+// Mixed scene stored as one FigureArray per concrete shape type. Bulk operations run one
+// tight loop per segment on the final shape classes, so no call goes through the vtable.
+// Elements are grouped by type: iteration order is rectangles, rhombi, then trapezoids,
+// each in insertion order.
+template <Scalar T>
+class FigureCollection {
+ public:
+  FigureCollection();
+  explicit FigureCollection(std::pmr::memory_resource* resource);
+
+  template <typename Shape>
+    requires OneOf<std::remove_cvref_t<Shape>, Rectangle<T>, Rhombus<T>, Trapezoid<T>>
+  void PushBack(Shape&& figure);
+
+  template <typename Shape, typename... Args>
+    requires OneOf<Shape, Rectangle<T>, Rhombus<T>, Trapezoid<T>>
+  const Shape& Emplace(Args&&... args);
+
+  template <typename Shape>
+  FigureArray<Shape>& Segment();
+  template <typename Shape>
+  const FigureArray<Shape>& Segment() const;
+
+  size_t Size() const;
+  bool Empty() const;
+  void Clear();
+
+  // Calls visitor(figure) for every element with its concrete type.
+  template <typename Visitor>
+  void ForEach(Visitor&& visitor) const;
+
+  double GetTotalArea() const;
+  std::vector<Point<T>> ComputeCenters() const;
+  void PrintAll(std::ostream& os) const;
+
+  template <Scalar U>
+  friend std::ostream& operator<<(std::ostream& os, const FigureCollection<U>& collection);
+
+ private:
+  std::tuple<FigureArray<Rectangle<T>>, FigureArray<Rhombus<T>>, FigureArray<Trapezoid<T>>>
+      segments_;
+};
+
+}  // namespace geometry
+
+#include "figure_collection.ipp"
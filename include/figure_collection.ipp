@@ -0,0 +1,103 @@
+#pragma once
+
+#include <utility>
+
+namespace geometry {
+
+template <Scalar T>
+FigureCollection<T>::FigureCollection() : FigureCollection(std::pmr::get_default_resource()) {
+}
+
+template <Scalar T>
+FigureCollection<T>::FigureCollection(std::pmr::memory_resource* resource)
+    : segments_(FigureArray<Rectangle<T>>(resource), FigureArray<Rhombus<T>>(resource),
+                FigureArray<Trapezoid<T>>(resource)) {
+}
+
+template <Scalar T>
+template <typename Shape>
+  requires OneOf<std::remove_cvref_t<Shape>, Rectangle<T>, Rhombus<T>, Trapezoid<T>>
+void FigureCollection<T>::PushBack(Shape&& figure) {
+  Segment<std::remove_cvref_t<Shape>>().PushBack(std::forward<Shape>(figure));
+}
+
+template <Scalar T>
+template <typename Shape, typename... Args>
+  requires OneOf<Shape, Rectangle<T>, Rhombus<T>, Trapezoid<T>>
+const Shape& FigureCollection<T>::Emplace(Args&&... args) {
+  return Segment<Shape>().EmplaceBack(std::forward<Args>(args)...);
+}
+
+template <Scalar T>
+template <typename Shape>
+FigureArray<Shape>& FigureCollection<T>::Segment() {
+  return std::get<FigureArray<Shape>>(segments_);
+}
+
+template <Scalar T>
+template <typename Shape>
+const FigureArray<Shape>& FigureCollection<T>::Segment() const {
+  return std::get<FigureArray<Shape>>(segments_);
+}
+
+template <Scalar T>
+size_t FigureCollection<T>::Size() const {
+  return std::apply([](const auto&... segment) { return (segment.Size() + ...); }, segments_);
+}
+
+template <Scalar T>
+bool FigureCollection<T>::Empty() const {
+  return Size() == 0;
+}
+
+template <Scalar T>
+void FigureCollection<T>::Clear() {
+  std::apply([](auto&... segment) { (segment.Clear(), ...); }, segments_);
+}
+
+template <Scalar T>
+template <typename Visitor>
+void FigureCollection<T>::ForEach(Visitor&& visitor) const {
+  std::apply(
+      [&](const auto&... segment) {
+        auto visit_segment = [&](const auto& arr) {
+          for (size_t i = 0; i < arr.Size(); ++i) {
+            visitor(arr[i]);
+          }
+        };
+        (visit_segment(segment), ...);
+      },
+      segments_);
+}
+
+template <Scalar T>
+double FigureCollection<T>::GetTotalArea() const {
+  return std::apply(
+      [](const auto&... segment) { return (0.0 + ... + segment.GetTotalArea()); }, segments_);
+}
+
+template <Scalar T>
+std::vector<Point<T>> FigureCollection<T>::ComputeCenters() const {
+  std::vector<Point<T>> centers;
+  centers.reserve(Size());
+  ForEach([&](const auto& figure) { centers.push_back(figure.GetCenter()); });
+  return centers;
+}
+
+template <Scalar T>
+void FigureCollection<T>::PrintAll(std::ostream& os) const {
+  size_t index = 0;
+  ForEach([&](const auto& figure) {
+    os << "Element " << index++ << ": " << figure << " | ";
+    os << "Center: " << figure.GetCenter() << " | ";
+    os << "Area: " << static_cast<double>(figure) << "\n";
+  });
+}
+
+template <Scalar U>
+std::ostream& operator<<(std::ostream& os, const FigureCollection<U>& collection) {
+  collection.PrintAll(os);
+  return os;
+}
+
+}  // namespace geometry
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "batch_kernels.hpp"
+#include "figure_batch.hpp"
+#include "figure_vector.hpp"
+
+namespace geometry {
+
+// On-disk layout (native byte order, all offsets in bytes):
+//   [0, 64)                      FigureFileHeader
+//   [64 + k * stride, ...)       column k, k = 0..7: x0 x1 x2 x3 y0 y1 y2 y3
+// Each column holds `count` scalars and is padded to a multiple of COLUMN_ALIGNMENT so every
+// column starts cache-line aligned inside the mapping.
+struct FigureFileHeader {
+  static constexpr char MAGIC[8] = {'G', 'E', 'O', 'F', 'I', 'G', '\0', '\0'};
+  static constexpr uint32_t VERSION = 1;
+  static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+  static constexpr size_t COLUMN_ALIGNMENT = 64;
+
+  enum class ScalarKind : uint8_t {
+    SIGNED_INTEGER = 1,
+    UNSIGNED_INTEGER = 2,
+    FLOATING_POINT = 3,
+  };
+
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  ShapeKind shape_kind;
+  ScalarKind scalar_kind;
+  uint8_t scalar_size;
+  uint8_t vertex_count;
+  uint32_t reserved;
+  uint64_t count;
+  uint64_t column_stride;
+  uint8_t padding[24];
+};
+
+static_assert(sizeof(FigureFileHeader) == FigureFileHeader::COLUMN_ALIGNMENT);
+
+template <Scalar T, template <typename> class Shape>
+void WriteFigureFile(const std::string& path, const FigureArray<Shape<T>>& figures);
+
+// Read-only, zero-copy view of a figure file. The file is mapped with mmap, so opening is
+// O(1) and only the pages actually touched are read from disk. Shapes are materialized one
+// at a time by operator[]; bulk queries run the batch kernels directly on the mapping.
+template <Scalar T, template <typename> class Shape>
+class MappedFigureView {
+ public:
+  static constexpr size_t VERTEX_COUNT = VertexColumns<T>::VERTEX_COUNT;
+
+  // Throws std::system_error if the file cannot be opened or mapped and std::runtime_error
+  // if it is not a figure file of this shape and scalar type.
+  explicit MappedFigureView(const std::string& path);
+
+  MappedFigureView(const MappedFigureView&) = delete;
+  MappedFigureView& operator=(const MappedFigureView&) = delete;
+  MappedFigureView(MappedFigureView&& other) noexcept;
+  MappedFigureView& operator=(MappedFigureView&& other) noexcept;
+  ~MappedFigureView();
+
+  size_t Size() const;
+  bool Empty() const;
+
+  Shape<T> operator[](size_t index) const;
+
+  const T* X(size_t vertex) const;
+  const T* Y(size_t vertex) const;
+  VertexColumns<T> Columns() const;
+
+  void ComputeAreas(double* areas) const;
+  void ComputeCenters(double* center_x, double* center_y) const;
+  double GetTotalArea() const;
+
+ private:
+  void Unmap() noexcept;
+
+  void* mapping_;
+  size_t mapping_size_;
+  size_t size_;
+  const T* x_[VERTEX_COUNT];
+  const T* y_[VERTEX_COUNT];
+};
+
+}  // namespace geometry
+
+#include "figure_file.ipp"
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace geometry {
+
+namespace file_format {
+
+template <Scalar T>
+constexpr FigureFileHeader::ScalarKind ScalarKindOf() {
+  if constexpr (std::is_floating_point_v<T>) {
+    return FigureFileHeader::ScalarKind::FLOATING_POINT;
+  } else if constexpr (std::is_signed_v<T>) {
+    return FigureFileHeader::ScalarKind::SIGNED_INTEGER;
+  } else {
+    return FigureFileHeader::ScalarKind::UNSIGNED_INTEGER;
+  }
+}
+
+inline uint64_t ColumnStride(uint64_t count, size_t scalar_size) {
+  uint64_t bytes = count * scalar_size;
+  uint64_t alignment = FigureFileHeader::COLUMN_ALIGNMENT;
+  return (bytes + alignment - 1) / alignment * alignment;
+}
+
+template <Scalar T, template <typename> class Shape>
+FigureFileHeader MakeHeader(uint64_t count) {
+  FigureFileHeader header{};
+  std::memcpy(header.magic, FigureFileHeader::MAGIC, sizeof(header.magic));
+  header.version = FigureFileHeader::VERSION;
+  header.byte_order = FigureFileHeader::BYTE_ORDER_MARK;
+  header.shape_kind = ShapeTraits<Shape>::KIND;
+  header.scalar_kind = ScalarKindOf<T>();
+  header.scalar_size = sizeof(T);
+  header.vertex_count = VertexColumns<T>::VERTEX_COUNT;
+  header.count = count;
+  header.column_stride = ColumnStride(count, sizeof(T));
+  return header;
+}
+
+}  // namespace file_format
+
+template <Scalar T, template <typename> class Shape>
+void WriteFigureFile(const std::string& path, const FigureArray<Shape<T>>& figures) {
+  constexpr size_t VERTEX_COUNT = VertexColumns<T>::VERTEX_COUNT;
+  constexpr size_t BLOCK_SIZE = 1 << 16;
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    throw std::runtime_error("Cannot open file for writing: " + path);
+  }
+
+  FigureFileHeader header = file_format::MakeHeader<T, Shape>(figures.Size());
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  // Columns are gathered block by block so the writer never holds a second full copy.
+  std::vector<T> block(std::min(figures.Size(), BLOCK_SIZE));
+  const char zeros[FigureFileHeader::COLUMN_ALIGNMENT] = {};
+  size_t padding = header.column_stride - figures.Size() * sizeof(T);
+  for (size_t column = 0; column < 2 * VERTEX_COUNT; ++column) {
+    size_t vertex = column % VERTEX_COUNT;
+    bool is_x = column < VERTEX_COUNT;
+    for (size_t begin = 0; begin < figures.Size(); begin += BLOCK_SIZE) {
+      size_t end = std::min(figures.Size(), begin + BLOCK_SIZE);
+      for (size_t i = begin; i < end; ++i) {
+        const Point<T>& point = figures[i].GetVertex(vertex);
+        block[i - begin] = is_x ? point.x : point.y;
+      }
+      file.write(reinterpret_cast<const char*>(block.data()),
+                 static_cast<std::streamsize>((end - begin) * sizeof(T)));
+    }
+    file.write(zeros, static_cast<std::streamsize>(padding));
+  }
+
+  file.flush();
+  if (!file) {
+    throw std::runtime_error("Failed to write figure file: " + path);
+  }
+}
+
+template <Scalar T, template <typename> class Shape>
+MappedFigureView<T, Shape>::MappedFigureView(const std::string& path)
+    : mapping_(nullptr), mapping_size_(0), size_(0), x_(), y_() {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::system_error(errno, std::generic_category(), "Cannot open file: " + path);
+  }
+  struct stat info{};
+  if (::fstat(fd, &info) != 0) {
+    int error = errno;
+    ::close(fd);
+    throw std::system_error(error, std::generic_category(), "Cannot stat file: " + path);
+  }
+  if (static_cast<size_t>(info.st_size) < sizeof(FigureFileHeader)) {
+    ::close(fd);
+    throw std::runtime_error("Not a figure file (too short): " + path);
+  }
+
+  mapping_size_ = static_cast<size_t>(info.st_size);
+  void* mapping = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fd, 0);
+  int error = errno;
+  // The mapping keeps its own reference to the file.
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    throw std::system_error(error, std::generic_category(), "Cannot map file: " + path);
+  }
+  mapping_ = mapping;
+
+  FigureFileHeader expected = file_format::MakeHeader<T, Shape>(0);
+  FigureFileHeader header;
+  std::memcpy(&header, mapping_, sizeof(header));
+  const char* problem = nullptr;
+  if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0) {
+    problem = "bad magic";
+  } else if (header.version != expected.version) {
+    problem = "unsupported version";
+  } else if (header.byte_order != expected.byte_order) {
+    problem = "byte order mismatch";
+  } else if (header.shape_kind != expected.shape_kind) {
+    problem = "shape type mismatch";
+  } else if (header.scalar_kind != expected.scalar_kind ||
+             header.scalar_size != expected.scalar_size) {
+    problem = "scalar type mismatch";
+  } else if (header.vertex_count != expected.vertex_count ||
+             header.column_stride != file_format::ColumnStride(header.count, sizeof(T)) ||
+             header.count > (mapping_size_ - sizeof(header)) / sizeof(T) ||
+             sizeof(header) + 2 * VERTEX_COUNT * header.column_stride > mapping_size_) {
+    problem = "truncated or corrupt column data";
+  }
+  if (problem != nullptr) {
+    Unmap();
+    throw std::runtime_error(std::string("Invalid figure file (") + problem + "): " + path);
+  }
+
+  size_ = static_cast<size_t>(header.count);
+  const char* columns = static_cast<const char*>(mapping_) + sizeof(header);
+  for (size_t k = 0; k < VERTEX_COUNT; ++k) {
+    x_[k] = reinterpret_cast<const T*>(columns + k * header.column_stride);
+    y_[k] = reinterpret_cast<const T*>(columns + (VERTEX_COUNT + k) * header.column_stride);
+  }
+}
+
+template <Scalar T, template <typename> class Shape>
+MappedFigureView<T, Shape>::MappedFigureView(MappedFigureView&& other) noexcept
+    : mapping_(other.mapping_), mapping_size_(other.mapping_size_), size_(other.size_) {
+  std::copy(other.x_, other.x_ + VERTEX_COUNT, x_);
+  std::copy(other.y_, other.y_ + VERTEX_COUNT, y_);
+  other.mapping_ = nullptr;
+  other.mapping_size_ = 0;
+  other.size_ = 0;
+}
+
+template <Scalar T, template <typename> class Shape>
+MappedFigureView<T, Shape>& MappedFigureView<T, Shape>::operator=(
+    MappedFigureView&& other) noexcept {
+  if (this != &other) {
+    Unmap();
+    mapping_ = other.mapping_;
+    mapping_size_ = other.mapping_size_;
+    size_ = other.size_;
+    std::copy(other.x_, other.x_ + VERTEX_COUNT, x_);
+    std::copy(other.y_, other.y_ + VERTEX_COUNT, y_);
+    other.mapping_ = nullptr;
+    other.mapping_size_ = 0;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+template <Scalar T, template <typename> class Shape>
+MappedFigureView<T, Shape>::~MappedFigureView() {
+  Unmap();
+}
+
+template <Scalar T, template <typename> class Shape>
+void MappedFigureView<T, Shape>::Unmap() noexcept {
+  if (mapping_ != nullptr) {
+    ::munmap(mapping_, mapping_size_);
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+  }
+}
+
+template <Scalar T, template <typename> class Shape>
+size_t MappedFigureView<T, Shape>::Size() const {
+  return size_;
+}
+
+template <Scalar T, template <typename> class Shape>
+bool MappedFigureView<T, Shape>::Empty() const {
+  return size_ == 0;
+}
+
+template <Scalar T, template <typename> class Shape>
+Shape<T> MappedFigureView<T, Shape>::operator[](size_t index) const {
+  if (index >= Size()) {
+    throw std::out_of_range("Index out of range");
+  }
+  return Shape<T>(Point<T>(x_[0][index], y_[0][index]), Point<T>(x_[1][index], y_[1][index]),
+                  Point<T>(x_[2][index], y_[2][index]), Point<T>(x_[3][index], y_[3][index]));
+}
+
+template <Scalar T, template <typename> class Shape>
+const T* MappedFigureView<T, Shape>::X(size_t vertex) const {
+  if (vertex >= VERTEX_COUNT) {
+    throw std::out_of_range("Vertex index out of range");
+  }
+  return x_[vertex];
+}
+
+template <Scalar T, template <typename> class Shape>
+const T* MappedFigureView<T, Shape>::Y(size_t vertex) const {
+  if (vertex >= VERTEX_COUNT) {
+    throw std::out_of_range("Vertex index out of range");
+  }
+  return y_[vertex];
+}
+
+template <Scalar T, template <typename> class Shape>
+VertexColumns<T> MappedFigureView<T, Shape>::Columns() const {
+  VertexColumns<T> columns;
+  for (size_t k = 0; k < VERTEX_COUNT; ++k) {
+    columns.x[k] = x_[k];
+    columns.y[k] = y_[k];
+  }
+  columns.size = Size();
+  return columns;
+}
+
+template <Scalar T, template <typename> class Shape>
+void MappedFigureView<T, Shape>::ComputeAreas(double* areas) const {
+  BatchAreas<AREA_FORMULA<T, Shape>>(Columns(), areas);
+}
+
+template <Scalar T, template <typename> class Shape>
+void MappedFigureView<T, Shape>::ComputeCenters(double* center_x, double* center_y) const {
+  BatchCenters(Columns(), center_x, center_y);
+}
+
+template <Scalar T, template <typename> class Shape>
+double MappedFigureView<T, Shape>::GetTotalArea() const {
+  return BatchTotalArea<AREA_FORMULA<T, Shape>>(Columns());
+}
+
+}  // namespace geometry
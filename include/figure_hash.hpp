@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "key_sort.hpp"
+#include "point.hpp"
+#include "thread_pool.hpp"
+
+namespace geometry {
+
+// Floating-point coordinates are hashed by the grid cell of this size they round to.
+inline constexpr double DEFAULT_GRID_CELL = Point<double>::EPSILON;
+
+// A point snapped to the hash grid. Integer coordinates are kept exactly; floating-point ones
+// become round(v / cell), so values closer than half a cell to the same grid line share it.
+// Two values within EPSILON of each other can still straddle a cell boundary: the grid
+// makes equality transitive, which tolerance comparison is not. -0.0 and 0.0 share a cell,
+// and so do all NaNs. Coordinates are stored as OrderedBits. A coordinate so large that
+// v / cell overflows is kept exactly and flagged in `exact`, so it never matches a cell.
+struct GridPoint {
+  static constexpr uint8_t EXACT_X = 1 << 0;
+  static constexpr uint8_t EXACT_Y = 1 << 1;
+
+  uint64_t x;
+  uint64_t y;
+  uint8_t exact;
+
+  auto operator<=>(const GridPoint& other) const = default;
+};
+
+// Shapes with four vertices readable through GetVertex.
+template <typename Shape>
+concept HashableFigure = requires(const Shape& shape) {
+  { shape.GetVertex(size_t{0}).x } -> std::convertible_to<double>;
+  { shape.GetVertex(size_t{0}).y } -> std::convertible_to<double>;
+};
+
+using CanonicalVertices = std::array<GridPoint, 4>;
+
+template <Scalar T>
+GridPoint ToGrid(const Point<T>& point, double cell = DEFAULT_GRID_CELL);
+
+// Snapped vertices in a canonical order: the same quadrilateral listed from any starting
+// vertex, clockwise or counter-clockwise, gives the same result (the least of the eight
+// rotations and reflections of the vertex cycle).
+template <HashableFigure Shape>
+CanonicalVertices Canonicalize(const Shape& shape, double cell = DEFAULT_GRID_CELL);
+
+uint64_t HashCanonical(const CanonicalVertices& vertices);
+
+// Hash of the snapped point; equal for points in the same grid cell.
+template <Scalar T>
+struct PointHash {
+  double cell = DEFAULT_GRID_CELL;
+
+  size_t operator()(const Point<T>& point) const;
+};
+
+// Hash of Canonicalize(shape); equal for shapes with the same canonical vertices.
+template <HashableFigure Shape>
+struct FigureHash {
+  double cell = DEFAULT_GRID_CELL;
+
+  size_t operator()(const Shape& shape) const;
+};
+
+namespace hashing {
+
+// Duplicates are grouped by the top bits of their hash into this many shards, each
+// resolved with its own open-addressing table; fixed, so results do not depend on threads.
+inline constexpr size_t SHARD_COUNT = 64;
+inline constexpr size_t HASH_CHUNK_SIZE = 1 << 14;
+
+// duplicate[i] is 1 when figures[i] has the same canonical vertices as an earlier figure.
+template <HashableFigure Shape>
+std::vector<uint8_t> FindDuplicates(const Shape* figures, size_t count, double cell,
+                                    ThreadPool* pool);
+
+void ValidateCell(double cell);
+
+}  // namespace hashing
+
+}  // namespace geometry
+
+#include "figure_hash.ipp"
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace geometry {
+
+namespace hashing {
+
+// round(value / cell), or value itself when the quotient overflows: a fine cell would
+// otherwise send every coordinate above about DBL_MAX * cell to the same infinite cell.
+// `exact` tells which, since a kept value can equal some other coordinate's cell.
+inline uint64_t SnapToGrid(double value, double cell, bool& exact) {
+  double scaled = value / cell;
+  exact = !std::isfinite(scaled);
+  return sorting::OrderedBits(exact ? value : std::nearbyint(scaled));
+}
+
+}  // namespace hashing
+
+template <Scalar T>
+GridPoint ToGrid(const Point<T>& point, double cell) {
+  if constexpr (std::is_floating_point_v<T>) {
+    bool exact_x = false;
+    bool exact_y = false;
+    uint64_t x = hashing::SnapToGrid(static_cast<double>(point.x), cell, exact_x);
+    uint64_t y = hashing::SnapToGrid(static_cast<double>(point.y), cell, exact_y);
+    return GridPoint{x, y,
+                     static_cast<uint8_t>((exact_x ? GridPoint::EXACT_X : 0) |
+                                          (exact_y ? GridPoint::EXACT_Y : 0))};
+  } else {
+    return GridPoint{sorting::OrderedBits(point.x), sorting::OrderedBits(point.y), 0};
+  }
+}
+
+template <HashableFigure Shape>
+CanonicalVertices Canonicalize(const Shape& shape, double cell) {
+  CanonicalVertices vertices;
+  for (size_t k = 0; k < vertices.size(); ++k) {
+    vertices[k] = ToGrid(shape.GetVertex(k), cell);
+  }
+  GridPoint least = *std::min_element(vertices.begin(), vertices.end());
+
+  // Only cycles that start at the least vertex can be the least sequence.
+  CanonicalVertices best;
+  bool found = false;
+  for (size_t start = 0; start < 4; ++start) {
+    if (vertices[start] != least) {
+      continue;
+    }
+    CanonicalVertices forward;
+    CanonicalVertices backward;
+    for (size_t j = 0; j < 4; ++j) {
+      forward[j] = vertices[(start + j) & 3];
+      backward[j] = vertices[(start + 4 - j) & 3];
+    }
+    CanonicalVertices& candidate = forward < backward ? forward : backward;
+    if (!found || candidate < best) {
+      best = candidate;
+      found = true;
+    }
+  }
+  return best;
+}
+
+namespace hashing {
+
+// splitmix64 finalizer.
+inline uint64_t Mix(uint64_t value) {
+  value ^= value >> 30;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27;
+  value *= 0x94d049bb133111ebULL;
+  value ^= value >> 31;
+  return value;
+}
+
+inline size_t Shard(uint64_t hash) {
+  return static_cast<size_t>(hash >> (64 - std::bit_width(SHARD_COUNT - 1)));
+}
+
+inline void ValidateCell(double cell) {
+  if (!(cell > 0.0) || !std::isfinite(cell)) {
+    throw std::invalid_argument("Grid cell must be positive and finite");
+  }
+}
+
+}  // namespace hashing
+
+inline uint64_t HashCanonical(const CanonicalVertices& vertices) {
+  uint64_t hash = 0;
+  for (const GridPoint& vertex : vertices) {
+    hash = hashing::Mix(hash + vertex.x + 0x9e3779b97f4a7c15ULL);
+    hash = hashing::Mix(hash + vertex.y + 0x9e3779b97f4a7c15ULL);
+    if (vertex.exact != 0) {
+      hash = hashing::Mix(hash + vertex.exact);
+    }
+  }
+  return hash;
+}
+
+template <Scalar T>
+size_t PointHash<T>::operator()(const Point<T>& point) const {
+  GridPoint grid = ToGrid(point, cell);
+  uint64_t hash = hashing::Mix(hashing::Mix(grid.x) + grid.y);
+  if (grid.exact != 0) {
+    hash = hashing::Mix(hash + grid.exact);
+  }
+  return static_cast<size_t>(hash);
+}
+
+template <HashableFigure Shape>
+size_t FigureHash<Shape>::operator()(const Shape& shape) const {
+  return static_cast<size_t>(HashCanonical(Canonicalize(shape, cell)));
+}
+
+namespace hashing {
+
+template <HashableFigure Shape>
+std::vector<uint8_t> FindDuplicates(const Shape* figures, size_t count, double cell,
+                                    ThreadPool* pool) {
+  ValidateCell(cell);
+  std::vector<uint8_t> duplicate(count, 0);
+  if (count < 2) {
+    return duplicate;
+  }
+
+  // Pass 1: hash every figure and count how many each chunk sends to each shard.
+  size_t chunks = (count + HASH_CHUNK_SIZE - 1) / HASH_CHUNK_SIZE;
+  std::vector<uint64_t> hashes(count);
+  std::vector<std::array<size_t, SHARD_COUNT>> offsets(chunks);
+  sorting::ForEachChunk(chunks, pool, [&](size_t chunk) {
+    std::array<size_t, SHARD_COUNT>& shard_count = offsets[chunk];
+    shard_count.fill(0);
+    size_t end = std::min(count, (chunk + 1) * HASH_CHUNK_SIZE);
+    for (size_t i = chunk * HASH_CHUNK_SIZE; i < end; ++i) {
+      hashes[i] = HashCanonical(Canonicalize(figures[i], cell));
+      ++shard_count[Shard(hashes[i])];
+    }
+  });
+
+  // Shard-major prefix sum, then scatter: each shard lists its figures in index order, so
+  // the first of several equal figures is the one a shard sees first.
+  std::array<size_t, SHARD_COUNT + 1> shard_begin;
+  size_t running = 0;
+  for (size_t shard = 0; shard < SHARD_COUNT; ++shard) {
+    shard_begin[shard] = running;
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+      size_t shard_count = offsets[chunk][shard];
+      offsets[chunk][shard] = running;
+      running += shard_count;
+    }
+  }
+  shard_begin[SHARD_COUNT] = running;
+  std::vector<size_t> order(count);
+  sorting::ForEachChunk(chunks, pool, [&](size_t chunk) {
+    std::array<size_t, SHARD_COUNT>& next = offsets[chunk];
+    size_t end = std::min(count, (chunk + 1) * HASH_CHUNK_SIZE);
+    for (size_t i = chunk * HASH_CHUNK_SIZE; i < end; ++i) {
+      order[next[Shard(hashes[i])]++] = i;
+    }
+  });
+
+  // Pass 2: per shard, a linear-probing table of first occurrences keyed by the hash's low
+  // bits. Equal hashes are confirmed on the canonical vertices.
+  constexpr size_t EMPTY = std::numeric_limits<size_t>::max();
+  sorting::ForEachChunk(SHARD_COUNT, pool, [&](size_t shard) {
+    size_t begin = shard_begin[shard];
+    size_t end = shard_begin[shard + 1];
+    if (end - begin < 2) {
+      return;
+    }
+    size_t mask = std::bit_ceil(2 * (end - begin)) - 1;
+    std::vector<size_t> table(mask + 1, EMPTY);
+    for (size_t position = begin; position < end; ++position) {
+      size_t i = order[position];
+      uint64_t hash = hashes[i];
+      size_t slot = static_cast<size_t>(hash) & mask;
+      bool have_key = false;
+      CanonicalVertices key;
+      while (table[slot] != EMPTY) {
+        size_t first = table[slot];
+        if (hashes[first] == hash) {
+          if (!have_key) {
+            key = Canonicalize(figures[i], cell);
+            have_key = true;
+          }
+          if (Canonicalize(figures[first], cell) == key) {
+            duplicate[i] = 1;
+            break;
+          }
+        }
+        slot = (slot + 1) & mask;
+      }
+      if (!duplicate[i]) {
+        table[slot] = i;
+      }
+    }
+  });
+  return duplicate;
+}
+
+}  // namespace hashing
+
+}  // namespace geometry
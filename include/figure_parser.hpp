@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "figure_vector.hpp"
+#include "point.hpp"
+
+namespace geometry {
+
+class ParseError : public std::runtime_error {
+ public:
+  ParseError(const std::string& message, size_t line, size_t column);
+
+  size_t Line() const;
+  size_t Column() const;
+
+ private:
+  size_t line_;
+  size_t column_;
+};
+
+// Reads the whitespace-separated format accepted by the shapes' operator>> (eight numbers per
+// figure: x1 y1 ... x4 y4) with std::from_chars. Input may arrive in arbitrary chunks; a
+// number split across two Feed calls is stitched back together. Parsed figures are staged
+// and appended to the output array batch by batch.
+template <typename Shape>
+class FigureParser {
+ public:
+  using ValueType = ShapeScalar<Shape>;
+
+  static constexpr size_t DEFAULT_BATCH_SIZE = 4096;
+
+  explicit FigureParser(FigureArray<Shape>& out, size_t batch_size = DEFAULT_BATCH_SIZE);
+
+  // Throws ParseError with the 1-based line and column of the offending number.
+  void Feed(std::string_view chunk);
+  // Flushes the last batch; throws ParseError if the input ends inside a figure.
+  void Finish();
+  // Called after each non-empty batch is appended to the output array, from Feed or Finish.
+  // It may move the figures out of the array.
+  void SetBatchCallback(std::function<void()> on_batch);
+
+  size_t FiguresParsed() const;
+
+ private:
+  static constexpr size_t COORDINATES_PER_FIGURE = 8;
+
+  void ParseNumber(std::string_view token, size_t line, size_t column);
+  void Flush();
+
+  FigureArray<Shape>* out_;
+  size_t batch_size_;
+  std::function<void()> on_batch_;
+  std::vector<ValueType> staged_;
+  std::string carry_;
+  size_t carry_line_;
+  size_t carry_column_;
+  size_t line_;
+  size_t column_;
+  size_t figures_parsed_;
+};
+
+// Each loader appends to `out` and returns the number of figures read.
+template <typename Shape>
+size_t LoadFigures(std::string_view text, FigureArray<Shape>& out);
+
+template <typename Shape>
+size_t LoadFigures(std::istream& is, FigureArray<Shape>& out);
+
+template <typename Shape>
+size_t LoadFiguresFromFile(const std::string& path, FigureArray<Shape>& out);
+
+}  // namespace geometry
+
+#include "figure_parser.ipp"
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <charconv>
+#include <fstream>
+#include <system_error>
+
+namespace geometry {
+
+inline ParseError::ParseError(const std::string& message, size_t line, size_t column)
+    : std::runtime_error("line " + std::to_string(line) + ", column " + std::to_string(column) +
+                         ": " + message),
+      line_(line),
+      column_(column) {
+}
+
+inline size_t ParseError::Line() const {
+  return line_;
+}
+
+inline size_t ParseError::Column() const {
+  return column_;
+}
+
+namespace parsing {
+
+inline bool IsSpace(char c) {
+  return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+}  // namespace parsing
+
+template <typename Shape>
+FigureParser<Shape>::FigureParser(FigureArray<Shape>& out, size_t batch_size)
+    : out_(&out),
+      batch_size_(batch_size == 0 ? 1 : batch_size),
+      carry_line_(0),
+      carry_column_(0),
+      line_(1),
+      column_(1),
+      figures_parsed_(0) {
+  staged_.reserve(batch_size_ * COORDINATES_PER_FIGURE);
+}
+
+template <typename Shape>
+void FigureParser<Shape>::Feed(std::string_view chunk) {
+  size_t pos = 0;
+  size_t size = chunk.size();
+
+  if (!carry_.empty()) {
+    while (pos < size && !parsing::IsSpace(chunk[pos])) {
+      ++pos;
+    }
+    carry_.append(chunk.data(), pos);
+    column_ += pos;
+    if (pos == size) {
+      return;
+    }
+    ParseNumber(carry_, carry_line_, carry_column_);
+    carry_.clear();
+  }
+
+  while (pos < size) {
+    char c = chunk[pos];
+    if (parsing::IsSpace(c)) {
+      if (c == '\n') {
+        ++line_;
+        column_ = 1;
+      } else {
+        ++column_;
+      }
+      ++pos;
+      continue;
+    }
+
+    size_t start = pos;
+    while (pos < size && !parsing::IsSpace(chunk[pos])) {
+      ++pos;
+    }
+    if (pos == size) {
+      carry_.assign(chunk.data() + start, pos - start);
+      carry_line_ = line_;
+      carry_column_ = column_;
+      column_ += pos - start;
+      return;
+    }
+    ParseNumber(chunk.substr(start, pos - start), line_, column_);
+    column_ += pos - start;
+  }
+}
+
+template <typename Shape>
+void FigureParser<Shape>::Finish() {
+  if (!carry_.empty()) {
+    ParseNumber(carry_, carry_line_, carry_column_);
+    carry_.clear();
+  }
+  size_t partial = staged_.size() % COORDINATES_PER_FIGURE;
+  if (partial != 0) {
+    throw ParseError("unexpected end of input: figure has " + std::to_string(partial) + " of " +
+                         std::to_string(COORDINATES_PER_FIGURE) + " coordinates",
+                     line_, column_);
+  }
+  Flush();
+}
+
+template <typename Shape>
+void FigureParser<Shape>::SetBatchCallback(std::function<void()> on_batch) {
+  on_batch_ = std::move(on_batch);
+}
+
+template <typename Shape>
+size_t FigureParser<Shape>::FiguresParsed() const {
+  return figures_parsed_ + staged_.size() / COORDINATES_PER_FIGURE;
+}
+
+template <typename Shape>
+void FigureParser<Shape>::ParseNumber(std::string_view token, size_t line, size_t column) {
+  // operator>> accepts an explicit plus sign, std::from_chars does not.
+  std::string_view digits = token;
+  if (digits.size() > 1 && digits.front() == '+' && digits[1] != '-' && digits[1] != '+') {
+    digits.remove_prefix(1);
+  }
+
+  ValueType value{};
+  std::from_chars_result result{};
+  if constexpr (std::is_floating_point_v<ValueType>) {
+    result = std::from_chars(digits.data(), digits.data() + digits.size(), value,
+                             std::chars_format::general);
+  } else {
+    result = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+  }
+
+  if (result.ec == std::errc::result_out_of_range) {
+    throw ParseError("number out of range: '" + std::string(token) + "'", line, column);
+  }
+  if (result.ec != std::errc() || result.ptr != digits.data() + digits.size()) {
+    throw ParseError("invalid number: '" + std::string(token) + "'", line, column);
+  }
+
+  staged_.push_back(value);
+  if (staged_.size() == batch_size_ * COORDINATES_PER_FIGURE) {
+    Flush();
+  }
+}
+
+template <typename Shape>
+void FigureParser<Shape>::Flush() {
+  size_t count = staged_.size() / COORDINATES_PER_FIGURE;
+  const ValueType* c = staged_.data();
+  for (size_t i = 0; i < count; ++i, c += COORDINATES_PER_FIGURE) {
+    out_->EmplaceBack(Point<ValueType>(c[0], c[1]), Point<ValueType>(c[2], c[3]),
+                      Point<ValueType>(c[4], c[5]), Point<ValueType>(c[6], c[7]));
+  }
+  figures_parsed_ += count;
+  staged_.erase(staged_.begin(), staged_.begin() + count * COORDINATES_PER_FIGURE);
+  if (count > 0 && on_batch_) {
+    on_batch_();
+  }
+}
+
+template <typename Shape>
+size_t LoadFigures(std::string_view text, FigureArray<Shape>& out) {
+  FigureParser<Shape> parser(out);
+  parser.Feed(text);
+  parser.Finish();
+  return parser.FiguresParsed();
+}
+
+template <typename Shape>
+size_t LoadFigures(std::istream& is, FigureArray<Shape>& out) {
+  constexpr size_t BUFFER_SIZE = 1 << 20;
+  std::vector<char> buffer(BUFFER_SIZE);
+  FigureParser<Shape> parser(out);
+  while (is) {
+    is.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    std::streamsize read = is.gcount();
+    if (read <= 0) {
+      break;
+    }
+    parser.Feed(std::string_view(buffer.data(), static_cast<size_t>(read)));
+  }
+  if (is.bad()) {
+    throw std::runtime_error("Failed to read figure stream");
+  }
+  parser.Finish();
+  return parser.FiguresParsed();
+}
+
+template <typename Shape>
+size_t LoadFiguresFromFile(const std::string& path, FigureArray<Shape>& out) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("Cannot open file: " + path);
+  }
+  return LoadFigures(file, out);
+}
+
+}  // namespace geometry
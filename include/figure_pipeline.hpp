@@ -0,0 +1,100 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "affine_transform.hpp"
+#include "bounding_box.hpp"
+#include "figure_file.hpp"
+#include "figure_parser.hpp"
+#include "figure_vector.hpp"
+
+namespace geometry {
+
+// Aggregates over a figure stream. Areas come from the shapes' operator double.
+struct AreaStatistics {
+  // Figures that reached the aggregate stage.
+  size_t count = 0;
+  // Figures removed by Validate or by any other stage.
+  size_t rejected = 0;
+  // Compensated sum of per-batch sums taken in input order, so it does not depend on the
+  // worker count or on scheduling.
+  double total_area = 0.0;
+  double min_area = std::numeric_limits<double>::infinity();
+  double max_area = -std::numeric_limits<double>::infinity();
+  // Equal-width bins over [histogram_min, histogram_max). Areas outside the range land in
+  // the first or last bin; NaN areas are counted but not binned.
+  double histogram_min = 0.0;
+  double histogram_max = 0.0;
+  std::vector<size_t> histogram;
+  BoundingBox center_bounds;
+
+  // 0 for an empty stream.
+  double MeanArea() const;
+};
+
+struct PipelineOptions {
+  // Figures per batch handed from the parser to the workers.
+  size_t batch_size = 4096;
+  // Parsed batches that may wait for a worker.
+  size_t queue_capacity = 8;
+  // 0 selects std::thread::hardware_concurrency(), at least 1.
+  size_t worker_count = 0;
+  // No histogram when 0; otherwise histogram_max must exceed histogram_min.
+  size_t histogram_bins = 0;
+  double histogram_min = 0.0;
+  double histogram_max = 0.0;
+};
+
+// Computes AreaStatistics over a figure stream without materializing it. The calling thread
+// reads and parses fixed-size batches into a bounded queue; worker threads run the stages on
+// each batch and aggregate it. Batch buffers are recycled, so at most
+// queue_capacity + worker_count + 1 batches exist at once whatever the stream length.
+// The first exception from parsing or from a stage stops the pipeline and is rethrown once
+// every thread has finished.
+template <typename Shape>
+class FigurePipeline {
+ public:
+  using Stage = std::function<void(FigureArray<Shape>&)>;
+
+  // Throws std::invalid_argument for a zero batch size or queue capacity, or an empty
+  // histogram range.
+  explicit FigurePipeline(const PipelineOptions& options = PipelineOptions());
+
+  // Stages run on every batch in the order added, concurrently on different batches.
+  FigurePipeline& AddStage(Stage stage);
+  // Drops the figures for which is_valid returns false.
+  FigurePipeline& Validate(std::function<bool(const Shape&)> is_valid);
+  FigurePipeline& Transform(const AffineTransform& transform) requires Transformable<Shape>;
+
+  // Text input in the operator>> format, parsed by FigureParser; ParseError propagates.
+  AreaStatistics Run(std::istream& is) const;
+  // Text already in memory, e.g. a mapped file; parsed in READ_CHUNK_SIZE slices.
+  AreaStatistics Run(std::string_view text) const;
+  AreaStatistics RunFile(const std::string& path) const;
+  // Binary figure file; shapes are materialized batch by batch.
+  template <Scalar T, template <typename> class ShapeTemplate>
+    requires std::same_as<ShapeTemplate<T>, Shape>
+  AreaStatistics Run(const MappedFigureView<T, ShapeTemplate>& view) const;
+
+ private:
+  static constexpr size_t READ_CHUNK_SIZE = 1 << 16;
+
+  // produce(current, submit) fills `current` and calls submit() whenever it holds a batch;
+  // submit returns false once the pipeline is shutting down.
+  template <typename Producer>
+  AreaStatistics Execute(Producer produce) const;
+
+  PipelineOptions options_;
+  std::vector<Stage> stages_;
+};
+
+}  // namespace geometry
+
+#include "figure_pipeline.ipp"
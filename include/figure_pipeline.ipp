@@ -0,0 +1,277 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "bounded_queue.hpp"
+#include "summation.hpp"
+
+namespace geometry {
+
+inline double AreaStatistics::MeanArea() const {
+  return count == 0 ? 0.0 : total_area / static_cast<double>(count);
+}
+
+namespace pipeline {
+
+inline void Accumulate(AreaStatistics& stats, double area, double center_x, double center_y) {
+  ++stats.count;
+  stats.min_area = std::min(stats.min_area, area);
+  stats.max_area = std::max(stats.max_area, area);
+  stats.center_bounds.Expand(center_x, center_y);
+  size_t bins = stats.histogram.size();
+  if (bins != 0 && !std::isnan(area)) {
+    double position = (area - stats.histogram_min) / (stats.histogram_max - stats.histogram_min) *
+                      static_cast<double>(bins);
+    size_t bin = position <= 0.0 ? 0
+                 : position >= static_cast<double>(bins) ? bins - 1
+                                                         : static_cast<size_t>(position);
+    ++stats.histogram[bin];
+  }
+}
+
+// Combines everything except total_area, which the pipeline sums in input order.
+inline void MergeCounts(AreaStatistics& into, const AreaStatistics& from) {
+  into.count += from.count;
+  into.rejected += from.rejected;
+  into.min_area = std::min(into.min_area, from.min_area);
+  into.max_area = std::max(into.max_area, from.max_area);
+  into.center_bounds.Expand(from.center_bounds);
+  for (size_t bin = 0; bin < into.histogram.size(); ++bin) {
+    into.histogram[bin] += from.histogram[bin];
+  }
+}
+
+}  // namespace pipeline
+
+template <typename Shape>
+FigurePipeline<Shape>::FigurePipeline(const PipelineOptions& options) : options_(options) {
+  if (options_.batch_size == 0) {
+    throw std::invalid_argument("Batch size must be positive");
+  }
+  if (options_.queue_capacity == 0) {
+    throw std::invalid_argument("Queue capacity must be positive");
+  }
+  if (options_.histogram_bins != 0 && !(options_.histogram_max > options_.histogram_min)) {
+    throw std::invalid_argument("Histogram range must not be empty");
+  }
+  if (options_.worker_count == 0) {
+    options_.worker_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+  }
+}
+
+template <typename Shape>
+FigurePipeline<Shape>& FigurePipeline<Shape>::AddStage(Stage stage) {
+  stages_.push_back(std::move(stage));
+  return *this;
+}
+
+template <typename Shape>
+FigurePipeline<Shape>& FigurePipeline<Shape>::Validate(std::function<bool(const Shape&)> is_valid) {
+  return AddStage([is_valid = std::move(is_valid)](FigureArray<Shape>& figures) {
+    figures.EraseIf([&](const Shape& figure) { return !is_valid(figure); });
+  });
+}
+
+template <typename Shape>
+FigurePipeline<Shape>& FigurePipeline<Shape>::Transform(
+    const AffineTransform& transform) requires Transformable<Shape> {
+  return AddStage([transform](FigureArray<Shape>& figures) { figures.Transform(transform); });
+}
+
+template <typename Shape>
+AreaStatistics FigurePipeline<Shape>::Run(std::istream& is) const {
+  return Execute([&](FigureArray<Shape>& current, const auto& submit) {
+    FigureParser<Shape> parser(current, options_.batch_size);
+    bool stopped = false;
+    parser.SetBatchCallback([&] { stopped = stopped || !submit(); });
+    std::vector<char> buffer(READ_CHUNK_SIZE);
+    while (is && !stopped) {
+      is.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      std::streamsize read = is.gcount();
+      if (read <= 0) {
+        break;
+      }
+      parser.Feed(std::string_view(buffer.data(), static_cast<size_t>(read)));
+    }
+    if (stopped) {
+      return;
+    }
+    if (is.bad()) {
+      throw std::runtime_error("Failed to read figure stream");
+    }
+    parser.Finish();
+  });
+}
+
+template <typename Shape>
+AreaStatistics FigurePipeline<Shape>::Run(std::string_view text) const {
+  return Execute([&](FigureArray<Shape>& current, const auto& submit) {
+    FigureParser<Shape> parser(current, options_.batch_size);
+    bool stopped = false;
+    parser.SetBatchCallback([&] { stopped = stopped || !submit(); });
+    for (size_t pos = 0; pos < text.size() && !stopped; pos += READ_CHUNK_SIZE) {
+      parser.Feed(text.substr(pos, READ_CHUNK_SIZE));
+    }
+    if (!stopped) {
+      parser.Finish();
+    }
+  });
+}
+
+template <typename Shape>
+AreaStatistics FigurePipeline<Shape>::RunFile(const std::string& path) const {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("Cannot open file: " + path);
+  }
+  return Run(file);
+}
+
+template <typename Shape>
+template <Scalar T, template <typename> class ShapeTemplate>
+  requires std::same_as<ShapeTemplate<T>, Shape>
+AreaStatistics FigurePipeline<Shape>::Run(const MappedFigureView<T, ShapeTemplate>& view) const {
+  return Execute([&](FigureArray<Shape>& current, const auto& submit) {
+    for (size_t i = 0; i < view.Size(); ++i) {
+      current.PushBack(view[i]);
+      if (current.Size() == options_.batch_size && !submit()) {
+        return;
+      }
+    }
+  });
+}
+
+template <typename Shape>
+template <typename Producer>
+AreaStatistics FigurePipeline<Shape>::Execute(Producer produce) const {
+  struct Batch {
+    size_t sequence;
+    FigureArray<Shape> figures;
+  };
+
+  size_t worker_count = options_.worker_count;
+  BoundedQueue<Batch> parsed(options_.queue_capacity);
+  // Every batch buffer in circulation; the producer blocks here when all are in flight.
+  BoundedQueue<FigureArray<Shape>> recycled(options_.queue_capacity + worker_count);
+  for (size_t i = 0; i < recycled.Capacity(); ++i) {
+    recycled.Push(FigureArray<Shape>());
+  }
+
+  AreaStatistics empty_stats;
+  empty_stats.histogram_min = options_.histogram_min;
+  empty_stats.histogram_max = options_.histogram_max;
+  empty_stats.histogram.assign(options_.histogram_bins, 0);
+  std::vector<AreaStatistics> partial(worker_count, empty_stats);
+
+  std::mutex mutex;
+  std::exception_ptr error;
+  // Batch sums that finished ahead of an earlier batch wait here, so the total is added in
+  // input order; at most every batch in flight is pending.
+  std::map<size_t, double> pending_sums;
+  size_t next_sum = 0;
+  KahanAccumulator total;
+
+  auto fail = [&](std::exception_ptr exception) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!error) {
+        error = exception;
+      }
+    }
+    parsed.Close();
+    recycled.Close();
+  };
+
+  auto work = [&](size_t worker) {
+    try {
+      AreaStatistics& stats = partial[worker];
+      while (std::optional<Batch> batch = parsed.Pop()) {
+        FigureArray<Shape>& figures = batch->figures;
+        size_t before = figures.Size();
+        for (const Stage& stage : stages_) {
+          stage(figures);
+        }
+        stats.rejected += before - figures.Size();
+
+        KahanAccumulator sum;
+        for (size_t i = 0; i < figures.Size(); ++i) {
+          const Shape& figure = figures[i];
+          double area = static_cast<double>(figure);
+          auto center = figure.GetCenter();
+          sum.Add(area);
+          pipeline::Accumulate(stats, area, static_cast<double>(center.x),
+                               static_cast<double>(center.y));
+        }
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          pending_sums.emplace(batch->sequence, sum.Sum());
+          while (!pending_sums.empty() && pending_sums.begin()->first == next_sum) {
+            total.Add(pending_sums.begin()->second);
+            pending_sums.erase(pending_sums.begin());
+            ++next_sum;
+          }
+        }
+
+        figures.Clear();
+        if (!recycled.Push(std::move(figures))) {
+          break;
+        }
+      }
+    } catch (...) {
+      fail(std::current_exception());
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(worker_count);
+  try {
+    for (size_t worker = 0; worker < worker_count; ++worker) {
+      workers.emplace_back(work, worker);
+    }
+
+    FigureArray<Shape> current;
+    size_t sequence = 0;
+    auto submit = [&]() {
+      if (current.Empty()) {
+        return true;
+      }
+      std::optional<FigureArray<Shape>> fresh = recycled.Pop();
+      if (!fresh) {
+        return false;
+      }
+      // `current` keeps its address: parsers hold on to it.
+      Batch batch{sequence++, std::move(current)};
+      current = std::move(*fresh);
+      return parsed.Push(std::move(batch));
+    };
+    produce(current, submit);
+    submit();
+  } catch (...) {
+    fail(std::current_exception());
+  }
+  parsed.Close();
+  for (std::thread& thread : workers) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  AreaStatistics result = empty_stats;
+  for (const AreaStatistics& stats : partial) {
+    pipeline::MergeCounts(result, stats);
+  }
+  result.total_area = total.Sum();
+  return result;
+}
+
+}  // namespace geometry
@@ -1,8 +1,23 @@
 #pragma once
 
+#include <atomic>
 #include <concepts>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "affine_transform.hpp"
+#include "figure_hash.hpp"
+#include "instrumentation.hpp"
+#include "key_sort.hpp"
+#include "relocation.hpp"
+#include "summation.hpp"
+#include "thread_pool.hpp"
 
 namespace geometry {
 
@@ -11,10 +26,38 @@ concept HasArea = requires(T t) {
   { static_cast<double>(t) } -> std::convertible_to<double>;
 };
 
+template <typename T>
+concept HasCenter = requires(const T& t) { t.GetCenter(); };
+
+template <typename T>
+concept Transformable = requires(T t, const AffineTransform& transform) {
+  t.Transform(transform);
+};
+
+template <typename Shape>
+using ShapeScalar = std::remove_cvref_t<decltype(std::declval<const Shape&>().GetVertex(0).x)>;
+
+// Shapes that accept a PointTransformer, so an array transform picks the SIMD kernel once
+// rather than once per shape.
+template <typename T>
+concept PointTransformable =
+    requires(const T& t) { t.GetVertex(0).x; } && Scalar<ShapeScalar<T>> &&
+    requires(T t, const PointTransformer<ShapeScalar<T>>& transformer) {
+      t.Transform(transformer);
+    };
+
+// Function object that maps an element to an arithmetic ordering key, e.g. its area.
+template <typename KeyFunction, typename T>
+concept SortKeyFor =
+    std::invocable<const KeyFunction&, const T&> &&
+    RadixSortable<std::remove_cvref_t<std::invoke_result_t<const KeyFunction&, const T&>>>;
+
 template <typename T>
 class FigureArray {
  public:
   FigureArray();
+  // Element storage is obtained from `resource`, which must outlive the array.
+  explicit FigureArray(std::pmr::memory_resource* resource);
   FigureArray(const FigureArray&) = delete;
   FigureArray& operator=(const FigureArray&) = delete;
   FigureArray(FigureArray&& other) noexcept;
@@ -25,21 +68,99 @@ class FigureArray {
   void Insert(size_t pos, T&& value);
   void PushBack(const T& value);
   void PushBack(T&& value);
+  // The new element is returned read-only; edit elements through operator[] or Modify.
+  template <typename... Args>
+  const T& Emplace(size_t pos, Args&&... args);
+  template <typename... Args>
+  const T& EmplaceBack(Args&&... args);
   void Erase(size_t index);
 
+  // Bulk edits move every element at most once and grow capacity at most once.
+  // Removes the elements for which pred(element) is true in one stable pass and returns how
+  // many were removed.
+  template <typename Predicate>
+  size_t EraseIf(Predicate pred);
+  // Same result; pred is evaluated concurrently and must be safe to call from several
+  // threads. Survivors are relocated into a new buffer of the same capacity.
+  template <typename Predicate>
+  size_t EraseIf(Predicate pred, ThreadPool& pool);
+  // Removes the elements in [first, last).
+  void RemoveRange(size_t first, size_t last);
+  // Inserts copies of [first, last) before pos. The range may refer to this array.
+  template <std::forward_iterator Iterator>
+  void InsertRange(size_t pos, Iterator first, Iterator last);
+  // Moves every element of `other` to the end of this array and leaves `other` empty.
+  void Append(FigureArray&& other);
+  // Removes every element whose canonical vertices (figure_hash.hpp) match those of an
+  // earlier element, keeping first occurrences in order, and returns how many were removed.
+  // Expected O(n): elements are hashed, then resolved in per-shard hash tables. The pool
+  // overload hashes and resolves shards concurrently; the result is the same.
+  size_t Deduplicate(double cell = DEFAULT_GRID_CELL) requires HashableFigure<T>;
+  size_t Deduplicate(ThreadPool& pool, double cell = DEFAULT_GRID_CELL)
+      requires HashableFigure<T>;
+
   size_t Size() const;
+  size_t Capacity() const;
   bool Empty() const;
 
+  // For elements with an area, mutable access marks the running total stale and the next
+  // GetTotalArea recomputes it, so edits must be done before that call.
   T& operator[](size_t index);
   const T& operator[](size_t index) const;
+  // Calls fn(element) on the element at `index` and adds the change of its area to the
+  // running total, which stays O(1).
+  template <typename Function>
+  void Modify(size_t index, Function fn);
 
   bool operator==(const FigureArray& other) const;
   bool operator!=(const FigureArray& other) const;
 
   void Clear();
   void Reserve(size_t new_capacity);
+  void ShrinkToFit();
+
+  // Capacity multiplier applied when an insertion needs more room; must be greater than 1.
+  void SetGrowthFactor(double factor);
+  double GetGrowthFactor() const;
+
+  std::pmr::memory_resource* GetResource() const;
 
+  // O(1): every operation that adds, removes or changes an element keeps the running total
+  // up to date. The total is kept exactly, so it is the correctly rounded sum of the current
+  // areas however many elements came and went. After mutable operator[] access the first
+  // call recomputes it under a lock, so concurrent calls on a const array are safe.
   double GetTotalArea() const requires HasArea<T>;
+  double GetTotalArea(ThreadPool& pool) const requires HasArea<T>;
+  std::vector<double> ComputeAreas() const requires HasArea<T>;
+  std::vector<double> ComputeAreas(ThreadPool& pool) const requires HasArea<T>;
+  auto ComputeCenters() const requires HasCenter<T>;
+  auto ComputeCenters(ThreadPool& pool) const requires HasCenter<T>;
+  // Applies `transform` to every element in place and rebuilds the running total from the new
+  // areas in the same pass. The total is exact, so both overloads give the same result.
+  void Transform(const AffineTransform& transform) requires Transformable<T>;
+  void Transform(const AffineTransform& transform, ThreadPool& pool) requires Transformable<T>;
+
+  // Reordering: key(element) is evaluated once per element, the (key, index) pairs are
+  // radix sorted or selected, and the elements are then permuted in place. Equal keys keep
+  // their original order and NaN keys sort last. The pool overloads compute keys and sort
+  // concurrently and gather the elements into a new buffer; the result is the same.
+  template <SortKeyFor<T> KeyFunction>
+  void SortBy(KeyFunction key);
+  template <SortKeyFor<T> KeyFunction>
+  void SortBy(KeyFunction key, ThreadPool& pool);
+  // Puts the element that a full SortBy would place at `n` there, with no greater key
+  // before it and no smaller key after it.
+  template <SortKeyFor<T> KeyFunction>
+  void NthElement(size_t n, KeyFunction key);
+  template <SortKeyFor<T> KeyFunction>
+  void NthElement(size_t n, KeyFunction key, ThreadPool& pool);
+  // Moves the min(k, Size()) elements with the largest keys to the front in descending key
+  // order; the order of the remaining elements is unspecified.
+  template <SortKeyFor<T> KeyFunction>
+  void TopK(size_t k, KeyFunction key);
+  template <SortKeyFor<T> KeyFunction>
+  void TopK(size_t k, KeyFunction key, ThreadPool& pool);
+
   void PrintAll(std::ostream& os) const;
 
   template <typename U>
@@ -47,10 +168,50 @@ class FigureArray {
 
  private:
   static constexpr size_t INIT_CAPACITY = 4;
+  static constexpr double DEFAULT_GROWTH_FACTOR = 2.0;
+  // Fixed chunk length of the parallel operations. It does not depend on the thread count,
+  // so parallel reductions add the same partial sums in the same order on any pool.
+  static constexpr size_t PARALLEL_CHUNK_SIZE = 4096;
+
+  T* Allocate(size_t capacity) const;
+  void Deallocate(T* data, size_t capacity) const;
+  static void Relocate(T* from, size_t count, T* to);
+  static void Destroy(T* from, size_t count);
+  // Attributes an event to this FigureArray type; no-op unless GEOMETRY_INSTRUMENTATION.
+  static void Record(Counter counter, size_t amount = 1);
+
+  void AddToTotalArea(const T& figure);
+  void SubtractFromTotalArea(const T& figure);
+
+  // Transforms [begin, end) with one PointTransformer when T takes one and adds the new
+  // areas to `areas`.
+  void TransformRange(const AffineTransform& transform, size_t begin, size_t end,
+                      ExactAccumulator& areas);
+
+  size_t NextCapacity() const;
+  void Reallocate(size_t new_capacity);
+  size_t ChunkCount() const;
+
+  // (OrderedBits(key(element)), index) for every element, or ReverseOrderedBits when
+  // `descending` is set.
+  template <typename KeyFunction>
+  std::vector<sorting::SortEntry> ComputeKeys(const KeyFunction& key, bool descending) const;
+  template <typename KeyFunction>
+  std::vector<sorting::SortEntry> ComputeKeys(const KeyFunction& key, bool descending,
+                                              ThreadPool& pool) const;
+  // Reorders so that position i holds the element previously at order[i].second.
+  void Permute(std::vector<sorting::SortEntry>& order);
+  void Permute(const std::vector<sorting::SortEntry>& order, ThreadPool& pool);
 
   size_t sz_;
   size_t capacity_;
   T* data_;
+  double growth_factor_;
+  std::pmr::memory_resource* resource_;
+  mutable ExactAccumulator total_area_;
+  // Set by mutable operator[]; cleared once GetTotalArea has recomputed the total.
+  mutable std::atomic<bool> total_stale_;
+  mutable std::mutex total_mutex_;
 };
 
 }  // namespace geometry
@@ -1,114 +1,406 @@
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <utility>
 
 namespace geometry {
 
 template <typename T>
-FigureArray<T>::FigureArray() : sz_(0), capacity_(0), data_(nullptr) {
+FigureArray<T>::FigureArray() : FigureArray(std::pmr::get_default_resource()) {
+}
+
+template <typename T>
+FigureArray<T>::FigureArray(std::pmr::memory_resource* resource)
+    : sz_(0),
+      capacity_(0),
+      data_(nullptr),
+      growth_factor_(DEFAULT_GROWTH_FACTOR),
+      resource_(resource),
+      total_area_(),
+      total_stale_(false) {
+  if (resource_ == nullptr) {
+    throw std::invalid_argument("Memory resource must not be null");
+  }
 }
 
 template <typename T>
 FigureArray<T>::FigureArray(FigureArray&& other) noexcept
-    : sz_(other.sz_), capacity_(other.capacity_), data_(other.data_) {
+    : sz_(other.sz_),
+      capacity_(other.capacity_),
+      data_(other.data_),
+      growth_factor_(other.growth_factor_),
+      resource_(other.resource_),
+      total_area_(other.total_area_),
+      total_stale_(other.total_stale_.load(std::memory_order_relaxed)) {
   other.sz_ = 0;
   other.capacity_ = 0;
   other.data_ = nullptr;
+  other.total_area_ = ExactAccumulator();
+  other.total_stale_.store(false, std::memory_order_relaxed);
 }
 
 template <typename T>
 FigureArray<T>& FigureArray<T>::operator=(FigureArray&& other) noexcept {
   if (this != &other) {
-    delete[] data_;
-    data_ = nullptr;
+    // The storage moves together with the resource that owns it.
+    Destroy(data_, sz_);
+    Deallocate(data_, capacity_);
     sz_ = other.sz_;
     capacity_ = other.capacity_;
     data_ = other.data_;
+    growth_factor_ = other.growth_factor_;
+    resource_ = other.resource_;
+    total_area_ = other.total_area_;
+    total_stale_.store(other.total_stale_.load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
 
     other.sz_ = 0;
     other.capacity_ = 0;
     other.data_ = nullptr;
+    other.total_area_ = ExactAccumulator();
+    other.total_stale_.store(false, std::memory_order_relaxed);
   }
   return *this;
 }
 
 template <typename T>
 FigureArray<T>::~FigureArray() {
-  delete[] data_;
+  Destroy(data_, sz_);
+  Deallocate(data_, capacity_);
   data_ = nullptr;
   capacity_ = 0;
 }
 
 template <typename T>
 void FigureArray<T>::Insert(size_t pos, const T& figure) {
+  Record(Counter::COPIES);
+  Emplace(pos, figure);
+}
+
+template <typename T>
+void FigureArray<T>::Insert(size_t pos, T&& figure) {
+  Emplace(pos, std::move(figure));
+}
+
+template <typename T>
+void FigureArray<T>::PushBack(const T& figure) {
+  Record(Counter::COPIES);
+  EmplaceBack(figure);
+}
+
+template <typename T>
+void FigureArray<T>::PushBack(T&& figure) {
+  EmplaceBack(std::move(figure));
+}
+
+template <typename T>
+template <typename... Args>
+const T& FigureArray<T>::Emplace(size_t pos, Args&&... args) {
   if (pos > sz_) {
     throw std::out_of_range("Insert position out of range");
   }
+  if (pos == sz_) {
+    return EmplaceBack(std::forward<Args>(args)...);
+  }
 
   if (sz_ == capacity_) {
-    size_t new_capacity;
-    if (capacity_ == 0) {
-      new_capacity = INIT_CAPACITY;
-    } else {
-      new_capacity = capacity_ * 2;
+    // Build the new element in the new buffer first: args may refer to current elements.
+    size_t new_capacity = NextCapacity();
+    T* new_data = Allocate(new_capacity);
+    try {
+      ::new (static_cast<void*>(new_data + pos)) T(std::forward<Args>(args)...);
+    } catch (...) {
+      Deallocate(new_data, new_capacity);
+      throw;
     }
-    Reserve(new_capacity);
+    Relocate(data_, pos, new_data);
+    Relocate(data_ + pos, sz_ - pos, new_data + pos + 1);
+    Deallocate(data_, capacity_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+    ++sz_;
+    AddToTotalArea(data_[pos]);
+    return data_[pos];
   }
 
-  for (size_t i = sz_; i > pos; --i) {
-    data_[i] = std::move(data_[i - 1]);
+  T value(std::forward<Args>(args)...);
+  Record(Counter::MOVES, sz_ - pos);
+  if constexpr (IsTriviallyRelocatable<T>::value) {
+    std::memmove(static_cast<void*>(data_ + pos + 1), static_cast<const void*>(data_ + pos),
+                 (sz_ - pos) * sizeof(T));
+    ::new (static_cast<void*>(data_ + pos)) T(std::move(value));
+  } else {
+    ::new (static_cast<void*>(data_ + sz_)) T(std::move(data_[sz_ - 1]));
+    for (size_t i = sz_ - 1; i > pos; --i) {
+      data_[i] = std::move(data_[i - 1]);
+    }
+    data_[pos] = std::move(value);
   }
-
-  data_[pos] = figure;
   ++sz_;
+  AddToTotalArea(data_[pos]);
+  return data_[pos];
 }
 
 template <typename T>
-void FigureArray<T>::Insert(size_t pos, T&& figure) {
-  if (pos > sz_) {
-    throw std::out_of_range("Insert position out of range");
+template <typename... Args>
+const T& FigureArray<T>::EmplaceBack(Args&&... args) {
+  if (sz_ == capacity_) {
+    size_t new_capacity = NextCapacity();
+    T* new_data = Allocate(new_capacity);
+    try {
+      ::new (static_cast<void*>(new_data + sz_)) T(std::forward<Args>(args)...);
+    } catch (...) {
+      Deallocate(new_data, new_capacity);
+      throw;
+    }
+    Relocate(data_, sz_, new_data);
+    Deallocate(data_, capacity_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+  } else {
+    ::new (static_cast<void*>(data_ + sz_)) T(std::forward<Args>(args)...);
+  }
+  AddToTotalArea(data_[sz_]);
+  return data_[sz_++];
+}
+
+template <typename T>
+void FigureArray<T>::Erase(size_t index) {
+  if (index >= sz_) {
+    throw std::out_of_range("Index out of range");
   }
 
-  if (sz_ == capacity_) {
-    size_t new_capacity;
-    if (capacity_ == 0) {
-      new_capacity = INIT_CAPACITY;
-    } else {
-      new_capacity = capacity_ * 2;
+  SubtractFromTotalArea(data_[index]);
+  Record(Counter::MOVES, sz_ - index - 1);
+  if constexpr (IsTriviallyRelocatable<T>::value) {
+    data_[index].~T();
+    std::memmove(static_cast<void*>(data_ + index), static_cast<const void*>(data_ + index + 1),
+                 (sz_ - index - 1) * sizeof(T));
+  } else {
+    for (size_t i = index; i < sz_ - 1; ++i) {
+      data_[i] = std::move(data_[i + 1]);
     }
-    Reserve(new_capacity);
+    data_[sz_ - 1].~T();
   }
 
-  for (size_t i = sz_; i > pos; --i) {
-    data_[i] = std::move(data_[i - 1]);
+  --sz_;
+}
+
+template <typename T>
+template <typename Predicate>
+size_t FigureArray<T>::EraseIf(Predicate pred) {
+  size_t kept = 0;
+  size_t i = 0;
+  try {
+    for (; i < sz_; ++i) {
+      if (pred(static_cast<const T&>(data_[i]))) {
+        SubtractFromTotalArea(data_[i]);
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+          data_[i].~T();
+        }
+        continue;
+      }
+      if (kept != i) {
+        Record(Counter::MOVES);
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+          std::memcpy(static_cast<void*>(data_ + kept), static_cast<const void*>(data_ + i),
+                      sizeof(T));
+        } else {
+          data_[kept] = std::move(data_[i]);
+        }
+      }
+      ++kept;
+    }
+  } catch (...) {
+    // Close the gap so the array stays dense: the unvisited tail follows the survivors.
+    size_t rest = sz_ - i;
+    Record(Counter::MOVES, kept != i ? rest : 0);
+    if constexpr (IsTriviallyRelocatable<T>::value) {
+      std::memmove(static_cast<void*>(data_ + kept), static_cast<const void*>(data_ + i),
+                   rest * sizeof(T));
+    } else {
+      for (size_t j = 0; j < rest && kept != i; ++j) {
+        data_[kept + j] = std::move(data_[i + j]);
+      }
+      Destroy(data_ + kept + rest, sz_ - kept - rest);
+    }
+    sz_ = kept + rest;
+    throw;
   }
 
-  data_[pos] = std::move(figure);
-  ++sz_;
+  size_t removed = sz_ - kept;
+  if constexpr (!IsTriviallyRelocatable<T>::value) {
+    Destroy(data_ + kept, removed);
+  }
+  sz_ = kept;
+  return removed;
 }
 
 template <typename T>
-void FigureArray<T>::PushBack(const T& figure) {
-  Insert(sz_, figure);
+template <typename Predicate>
+size_t FigureArray<T>::EraseIf(Predicate pred, ThreadPool& pool) {
+  // Pass 1 only reads, so a throwing predicate leaves the array untouched.
+  std::vector<uint8_t> erase(sz_);
+  std::vector<size_t> kept(ChunkCount());
+  std::vector<ExactAccumulator> removed_area(ChunkCount());
+  pool.ParallelFor(ChunkCount(), [&](size_t chunk) {
+    size_t begin = chunk * PARALLEL_CHUNK_SIZE;
+    size_t end = std::min(begin + PARALLEL_CHUNK_SIZE, sz_);
+    size_t count = 0;
+    for (size_t i = begin; i < end; ++i) {
+      erase[i] = pred(static_cast<const T&>(data_[i])) ? 1 : 0;
+      if (!erase[i]) {
+        ++count;
+      } else if constexpr (HasArea<T>) {
+        removed_area[chunk].Add(static_cast<double>(data_[i]));
+      }
+    }
+    kept[chunk] = count;
+  });
+
+  // Exclusive prefix sum: chunk c moves its survivors to [offset[c], offset[c] + kept[c]).
+  std::vector<size_t> offset(ChunkCount());
+  size_t survivors = 0;
+  for (size_t chunk = 0; chunk < kept.size(); ++chunk) {
+    offset[chunk] = survivors;
+    survivors += kept[chunk];
+  }
+  size_t removed = sz_ - survivors;
+  if (removed == 0) {
+    return 0;
+  }
+
+  // Pass 2 relocates into a fresh buffer, so no chunk reads what another one writes.
+  T* new_data = Allocate(capacity_);
+  pool.ParallelFor(ChunkCount(), [&](size_t chunk) {
+    size_t begin = chunk * PARALLEL_CHUNK_SIZE;
+    size_t end = std::min(begin + PARALLEL_CHUNK_SIZE, sz_);
+    size_t next = offset[chunk];
+    for (size_t i = begin; i < end; ++i) {
+      if (erase[i]) {
+        data_[i].~T();
+      } else {
+        Relocate(data_ + i, 1, new_data + next++);
+      }
+    }
+  });
+  Deallocate(data_, capacity_);
+  data_ = new_data;
+  sz_ = survivors;
+
+  for (const ExactAccumulator& area : removed_area) {
+    total_area_.Subtract(area);
+  }
+  return removed;
 }
 
 template <typename T>
-void FigureArray<T>::PushBack(T&& figure) {
-  Insert(sz_, std::move(figure));
+void FigureArray<T>::RemoveRange(size_t first, size_t last) {
+  if (first > last || last > sz_) {
+    throw std::out_of_range("Range out of range");
+  }
+  size_t count = last - first;
+  if (count == 0) {
+    return;
+  }
+  for (size_t i = first; i < last; ++i) {
+    SubtractFromTotalArea(data_[i]);
+  }
+  Record(Counter::MOVES, sz_ - last);
+  if constexpr (IsTriviallyRelocatable<T>::value) {
+    Destroy(data_ + first, count);
+    std::memmove(static_cast<void*>(data_ + first), static_cast<const void*>(data_ + last),
+                 (sz_ - last) * sizeof(T));
+  } else {
+    std::move(data_ + last, data_ + sz_, data_ + first);
+    Destroy(data_ + sz_ - count, count);
+  }
+  sz_ -= count;
 }
 
 template <typename T>
-void FigureArray<T>::Erase(size_t index) {
-  if (index >= sz_) {
-    throw std::out_of_range("Index out of range");
+template <std::forward_iterator Iterator>
+void FigureArray<T>::InsertRange(size_t pos, Iterator first, Iterator last) {
+  if (pos > sz_) {
+    throw std::out_of_range("Insert position out of range");
+  }
+  size_t count = static_cast<size_t>(std::distance(first, last));
+  if (count == 0) {
+    return;
   }
 
-  for (size_t i = index; i < sz_ - 1; ++i) {
-    data_[i] = std::move(data_[i + 1]);
+  // New elements are copied before anything moves, so the range may alias this array.
+  Record(Counter::COPIES, count);
+  if (sz_ + count > capacity_) {
+    size_t new_capacity = std::max(NextCapacity(), sz_ + count);
+    T* new_data = Allocate(new_capacity);
+    size_t built = 0;
+    try {
+      for (Iterator it = first; it != last; ++it, ++built) {
+        ::new (static_cast<void*>(new_data + pos + built)) T(*it);
+      }
+    } catch (...) {
+      Destroy(new_data + pos, built);
+      Deallocate(new_data, new_capacity);
+      throw;
+    }
+    Relocate(data_, pos, new_data);
+    Relocate(data_ + pos, sz_ - pos, new_data + pos + count);
+    Deallocate(data_, capacity_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+  } else {
+    size_t built = 0;
+    try {
+      for (Iterator it = first; it != last; ++it, ++built) {
+        ::new (static_cast<void*>(data_ + sz_ + built)) T(*it);
+      }
+    } catch (...) {
+      Destroy(data_ + sz_, built);
+      throw;
+    }
+    Record(Counter::MOVES, sz_ - pos + count);
+    std::rotate(data_ + pos, data_ + sz_, data_ + sz_ + count);
   }
+  sz_ += count;
+  for (size_t i = pos; i < pos + count; ++i) {
+    AddToTotalArea(data_[i]);
+  }
+}
 
-  --sz_;
+template <typename T>
+size_t FigureArray<T>::Deduplicate(double cell) requires HashableFigure<T> {
+  std::vector<uint8_t> duplicate = hashing::FindDuplicates(data_, sz_, cell, nullptr);
+  // EraseIf evaluates pred on each element before moving it, so the address gives its index.
+  return EraseIf([&](const T& figure) { return duplicate[&figure - data_] != 0; });
+}
+
+template <typename T>
+size_t FigureArray<T>::Deduplicate(ThreadPool& pool, double cell) requires HashableFigure<T> {
+  std::vector<uint8_t> duplicate = hashing::FindDuplicates(data_, sz_, cell, &pool);
+  return EraseIf([&](const T& figure) { return duplicate[&figure - data_] != 0; }, pool);
+}
+
+template <typename T>
+void FigureArray<T>::Append(FigureArray&& other) {
+  if (&other == this || other.sz_ == 0) {
+    return;
+  }
+  if (sz_ + other.sz_ > capacity_) {
+    Reallocate(std::max(NextCapacity(), sz_ + other.sz_));
+  }
+  Relocate(other.data_, other.sz_, data_ + sz_);
+  sz_ += other.sz_;
+  total_area_.Add(other.total_area_);
+  if (other.total_stale_.load(std::memory_order_relaxed)) {
+    total_stale_.store(true, std::memory_order_relaxed);
+  }
+  other.sz_ = 0;
+  other.total_area_ = ExactAccumulator();
+  other.total_stale_.store(false, std::memory_order_relaxed);
 }
 
 template <typename T>
@@ -116,6 +408,11 @@ size_t FigureArray<T>::Size() const {
   return sz_;
 }
 
+template <typename T>
+size_t FigureArray<T>::Capacity() const {
+  return capacity_;
+}
+
 template <typename T>
 bool FigureArray<T>::Empty() const {
   return sz_ == 0;
@@ -126,6 +423,9 @@ T& FigureArray<T>::operator[](size_t index) {
   if (index >= sz_) {
     throw std::out_of_range("Index out of range");
   }
+  if constexpr (HasArea<T>) {
+    total_stale_.store(true, std::memory_order_relaxed);
+  }
   return data_[index];
 }
 
@@ -137,6 +437,26 @@ const T& FigureArray<T>::operator[](size_t index) const {
   return data_[index];
 }
 
+template <typename T>
+template <typename Function>
+void FigureArray<T>::Modify(size_t index, Function fn) {
+  if (index >= sz_) {
+    throw std::out_of_range("Index out of range");
+  }
+  if constexpr (HasArea<T>) {
+    SubtractFromTotalArea(data_[index]);
+    try {
+      fn(data_[index]);
+    } catch (...) {
+      AddToTotalArea(data_[index]);
+      throw;
+    }
+    AddToTotalArea(data_[index]);
+  } else {
+    fn(data_[index]);
+  }
+}
+
 template <typename T>
 bool FigureArray<T>::operator==(const FigureArray& other) const {
   if (sz_ != other.sz_) {
@@ -157,7 +477,10 @@ bool FigureArray<T>::operator!=(const FigureArray& other) const {
 
 template <typename T>
 void FigureArray<T>::Clear() {
+  Destroy(data_, sz_);
   sz_ = 0;
+  total_area_ = ExactAccumulator();
+  total_stale_.store(false, std::memory_order_relaxed);
 }
 
 template <typename T>
@@ -165,25 +488,373 @@ void FigureArray<T>::Reserve(size_t new_capacity) {
   if (new_capacity <= capacity_) {
     return;
   }
+  Reallocate(new_capacity);
+}
 
-  T* new_data = new T[new_capacity];
+template <typename T>
+void FigureArray<T>::ShrinkToFit() {
+  if (capacity_ > sz_) {
+    Reallocate(sz_);
+  }
+}
 
-  for (size_t i = 0; i < sz_; ++i) {
-    new_data[i] = std::move(data_[i]);
+template <typename T>
+void FigureArray<T>::SetGrowthFactor(double factor) {
+  if (!(factor > 1.0)) {
+    throw std::invalid_argument("Growth factor must be greater than 1");
+  }
+  growth_factor_ = factor;
+}
+
+template <typename T>
+double FigureArray<T>::GetGrowthFactor() const {
+  return growth_factor_;
+}
+
+template <typename T>
+std::pmr::memory_resource* FigureArray<T>::GetResource() const {
+  return resource_;
+}
+
+template <typename T>
+T* FigureArray<T>::Allocate(size_t capacity) const {
+  if (capacity == 0) {
+    return nullptr;
   }
+  if (capacity > std::numeric_limits<size_t>::max() / sizeof(T)) {
+    throw std::length_error("FigureArray capacity overflow");
+  }
+  Record(Counter::ALLOCATIONS);
+  Record(Counter::ALLOCATED_BYTES, capacity * sizeof(T));
+  if (data_ != nullptr) {
+    Record(Counter::REALLOCATIONS);
+  }
+  return static_cast<T*>(resource_->allocate(capacity * sizeof(T), alignof(T)));
+}
 
-  delete[] data_;
+template <typename T>
+void FigureArray<T>::Deallocate(T* data, size_t capacity) const {
+  if (data != nullptr) {
+    Record(Counter::DEALLOCATIONS);
+    resource_->deallocate(data, capacity * sizeof(T), alignof(T));
+  }
+}
+
+template <typename T>
+void FigureArray<T>::Relocate(T* from, size_t count, T* to) {
+  if (count == 0) {
+    return;
+  }
+  Record(Counter::MOVES, count);
+  if constexpr (IsTriviallyRelocatable<T>::value) {
+    std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+  } else {
+    for (size_t i = 0; i < count; ++i) {
+      ::new (static_cast<void*>(to + i)) T(std::move_if_noexcept(from[i]));
+      from[i].~T();
+    }
+  }
+}
+
+template <typename T>
+void FigureArray<T>::Record(Counter counter, size_t amount) {
+  instrumentation::Record<FigureArray>(counter, amount);
+}
+
+template <typename T>
+void FigureArray<T>::Destroy(T* from, size_t count) {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (size_t i = 0; i < count; ++i) {
+      from[i].~T();
+    }
+  }
+}
+
+template <typename T>
+void FigureArray<T>::AddToTotalArea(const T& figure) {
+  if constexpr (HasArea<T>) {
+    total_area_.Add(static_cast<double>(figure));
+  }
+}
+
+template <typename T>
+void FigureArray<T>::SubtractFromTotalArea(const T& figure) {
+  if constexpr (HasArea<T>) {
+    total_area_.Subtract(static_cast<double>(figure));
+  }
+}
+
+template <typename T>
+size_t FigureArray<T>::NextCapacity() const {
+  if (capacity_ == 0) {
+    return INIT_CAPACITY;
+  }
+  size_t grown = static_cast<size_t>(static_cast<double>(capacity_) * growth_factor_);
+  return std::max(grown, capacity_ + 1);
+}
+
+template <typename T>
+void FigureArray<T>::Reallocate(size_t new_capacity) {
+  T* new_data = Allocate(new_capacity);
+  Relocate(data_, sz_, new_data);
+  Deallocate(data_, capacity_);
   data_ = new_data;
   capacity_ = new_capacity;
 }
 
 template <typename T>
 double FigureArray<T>::GetTotalArea() const requires HasArea<T> {
-  double total = 0.0;
+  // Double-checked: only the first call after mutable access rescans the elements.
+  if (total_stale_.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(total_mutex_);
+    if (total_stale_.load(std::memory_order_relaxed)) {
+      ExactAccumulator total;
+      for (size_t i = 0; i < sz_; ++i) {
+        total.Add(static_cast<double>(data_[i]));
+      }
+      total_area_ = total;
+      total_stale_.store(false, std::memory_order_release);
+    }
+  }
+  return total_area_.Sum();
+}
+
+template <typename T>
+size_t FigureArray<T>::ChunkCount() const {
+  return (sz_ + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+}
+
+template <typename T>
+template <typename KeyFunction>
+std::vector<sorting::SortEntry> FigureArray<T>::ComputeKeys(const KeyFunction& key,
+                                                            bool descending) const {
+  std::vector<sorting::SortEntry> keys(sz_);
   for (size_t i = 0; i < sz_; ++i) {
-    total += static_cast<double>(data_[i]);
+    auto value = key(static_cast<const T&>(data_[i]));
+    keys[i] = {descending ? sorting::ReverseOrderedBits(value) : sorting::OrderedBits(value), i};
   }
-  return total;
+  return keys;
+}
+
+template <typename T>
+template <typename KeyFunction>
+std::vector<sorting::SortEntry> FigureArray<T>::ComputeKeys(const KeyFunction& key,
+                                                            bool descending,
+                                                            ThreadPool& pool) const {
+  std::vector<sorting::SortEntry> keys(sz_);
+  pool.ParallelFor(ChunkCount(), [&](size_t chunk) {
+    size_t begin = chunk * PARALLEL_CHUNK_SIZE;
+    size_t end = std::min(begin + PARALLEL_CHUNK_SIZE, sz_);
+    for (size_t i = begin; i < end; ++i) {
+      auto value = key(static_cast<const T&>(data_[i]));
+      keys[i] = {descending ? sorting::ReverseOrderedBits(value) : sorting::OrderedBits(value),
+                 i};
+    }
+  });
+  return keys;
+}
+
+template <typename T>
+void FigureArray<T>::Permute(std::vector<sorting::SortEntry>& order) {
+  // Follows each cycle of the permutation once; visited positions are marked by pointing
+  // their source index at themselves.
+  for (size_t start = 0; start < sz_; ++start) {
+    if (order[start].second == start) {
+      continue;
+    }
+    T held(std::move(data_[start]));
+    size_t hole = start;
+    while (order[hole].second != start) {
+      size_t source = order[hole].second;
+      data_[hole] = std::move(data_[source]);
+      order[hole].second = hole;
+      hole = source;
+    }
+    data_[hole] = std::move(held);
+    order[hole].second = hole;
+  }
+}
+
+template <typename T>
+void FigureArray<T>::Permute(const std::vector<sorting::SortEntry>& order, ThreadPool& pool) {
+  if (sz_ == 0) {
+    return;
+  }
+  T* new_data = Allocate(capacity_);
+  pool.ParallelFor(ChunkCount(), [&](size_t chunk) {
+    size_t begin = chunk * PARALLEL_CHUNK_SIZE;
+    size_t end = std::min(begin + PARALLEL_CHUNK_SIZE, sz_);
+    for (size_t i = begin; i < end; ++i) {
+      Relocate(data_ + order[i].second, 1, new_data + i);
+    }
+  });
+  Deallocate(data_, capacity_);
+  data_ = new_data;
+}
+
+template <typename T>
+double FigureArray<T>::GetTotalArea(ThreadPool& pool) const requires HasArea<T> {
+  std::vector<double> partial(ChunkCount());
+  pool.ParallelFor(partial.size(), [&](size_t chunk) {
+    size_t begin = chunk * PARALLEL_CHUNK_SIZE;
+    size_t end = std::min(begin + PARALLEL_CHUNK_SIZE, sz_);
+    KahanAccumulator sum;
+    for (size_t i = begin; i < end; ++i) {
+      sum.Add(static_cast<double>(data_[i]));
+    }
+    partial[chunk] = sum.Sum();
+  });
+
+  KahanAccumulator total;
+  for (double value : partial) {
+    total.Add(value);
+  }
+  return total.Sum();
+}
+
+template <typename T>
+std::vector<double> FigureArray<T>::ComputeAreas() const requires HasArea<T> {
+  std::vector<double> areas(sz_);
+  for (size_t i = 0; i < sz_; ++i) {
+    areas[i] = static_cast<double>(data_[i]);
+  }
+  return areas;
+}
+
+template <typename T>
+std::vector<double> FigureArray<T>::ComputeAreas(ThreadPool& pool) const requires HasArea<T> {
+  std::vector<double> areas(sz_);
+  pool.ParallelFor(ChunkCount(), [&](size_t chunk) {
+    size_t begin = chunk * PARALLEL_CHUNK_SIZE;
+    size_t end = std::min(begin + PARALLEL_CHUNK_SIZE, sz_);
+    for (size_t i = begin; i < end; ++i) {
+      areas[i] = static_cast<double>(data_[i]);
+    }
+  });
+  return areas;
+}
+
+template <typename T>
+auto FigureArray<T>::ComputeCenters() const requires HasCenter<T> {
+  std::vector<decltype(data_[0].GetCenter())> centers(sz_);
+  for (size_t i = 0; i < sz_; ++i) {
+    centers[i] = data_[i].GetCenter();
+  }
+  return centers;
+}
+
+template <typename T>
+auto FigureArray<T>::ComputeCenters(ThreadPool& pool) const requires HasCenter<T> {
+  std::vector<decltype(data_[0].GetCenter())> centers(sz_);
+  pool.ParallelFor(ChunkCount(), [&](size_t chunk) {
+    size_t begin = chunk * PARALLEL_CHUNK_SIZE;
+    size_t end = std::min(begin + PARALLEL_CHUNK_SIZE, sz_);
+    for (size_t i = begin; i < end; ++i) {
+      centers[i] = data_[i].GetCenter();
+    }
+  });
+  return centers;
+}
+
+template <typename T>
+void FigureArray<T>::Transform(const AffineTransform& transform) requires Transformable<T> {
+  ExactAccumulator total;
+  TransformRange(transform, 0, sz_, total);
+  total_area_ = total;
+  total_stale_.store(false, std::memory_order_relaxed);
+}
+
+template <typename T>
+void FigureArray<T>::Transform(const AffineTransform& transform,
+                               ThreadPool& pool) requires Transformable<T> {
+  std::vector<ExactAccumulator> partial(ChunkCount());
+  pool.ParallelFor(ChunkCount(), [&](size_t chunk) {
+    size_t begin = chunk * PARALLEL_CHUNK_SIZE;
+    size_t end = std::min(begin + PARALLEL_CHUNK_SIZE, sz_);
+    TransformRange(transform, begin, end, partial[chunk]);
+  });
+  ExactAccumulator total;
+  for (const ExactAccumulator& chunk : partial) {
+    total.Add(chunk);
+  }
+  total_area_ = total;
+  total_stale_.store(false, std::memory_order_relaxed);
+}
+
+template <typename T>
+void FigureArray<T>::TransformRange(const AffineTransform& transform, size_t begin, size_t end,
+                                    ExactAccumulator& areas) {
+  auto apply = [&](const auto& how) {
+    for (size_t i = begin; i < end; ++i) {
+      data_[i].Transform(how);
+      if constexpr (HasArea<T>) {
+        areas.Add(static_cast<double>(data_[i]));
+      }
+    }
+  };
+  if constexpr (PointTransformable<T>) {
+    apply(PointTransformer<ShapeScalar<T>>(transform));
+  } else {
+    apply(transform);
+  }
+}
+
+template <typename T>
+template <SortKeyFor<T> KeyFunction>
+void FigureArray<T>::SortBy(KeyFunction key) {
+  std::vector<sorting::SortEntry> order = ComputeKeys(key, false);
+  sorting::RadixSort(order);
+  Permute(order);
+}
+
+template <typename T>
+template <SortKeyFor<T> KeyFunction>
+void FigureArray<T>::SortBy(KeyFunction key, ThreadPool& pool) {
+  std::vector<sorting::SortEntry> order = ComputeKeys(key, false, pool);
+  sorting::RadixSort(order, pool);
+  Permute(order, pool);
+}
+
+template <typename T>
+template <SortKeyFor<T> KeyFunction>
+void FigureArray<T>::NthElement(size_t n, KeyFunction key) {
+  if (n >= sz_) {
+    throw std::out_of_range("Index out of range");
+  }
+  std::vector<sorting::SortEntry> order = ComputeKeys(key, false);
+  std::nth_element(order.begin(), order.begin() + n, order.end());
+  Permute(order);
+}
+
+template <typename T>
+template <SortKeyFor<T> KeyFunction>
+void FigureArray<T>::NthElement(size_t n, KeyFunction key, ThreadPool& pool) {
+  if (n >= sz_) {
+    throw std::out_of_range("Index out of range");
+  }
+  std::vector<sorting::SortEntry> order = ComputeKeys(key, false, pool);
+  std::nth_element(order.begin(), order.begin() + n, order.end());
+  Permute(order, pool);
+}
+
+template <typename T>
+template <SortKeyFor<T> KeyFunction>
+void FigureArray<T>::TopK(size_t k, KeyFunction key) {
+  k = std::min(k, sz_);
+  std::vector<sorting::SortEntry> order = ComputeKeys(key, true);
+  std::nth_element(order.begin(), order.begin() + k, order.end());
+  std::sort(order.begin(), order.begin() + k);
+  Permute(order);
+}
+
+template <typename T>
+template <SortKeyFor<T> KeyFunction>
+void FigureArray<T>::TopK(size_t k, KeyFunction key, ThreadPool& pool) {
+  k = std::min(k, sz_);
+  std::vector<sorting::SortEntry> order = ComputeKeys(key, true, pool);
+  std::nth_element(order.begin(), order.begin() + k, order.end());
+  std::sort(order.begin(), order.begin() + k);
+  Permute(order, pool);
 }
 
 template <typename T>
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string_view>
+
+#include "figure_vector.hpp"
+#include "point.hpp"
+
+namespace geometry {
+
+enum class OutputFormat {
+  TEXT,        // PrintAll layout: "Element i: (x, y) ... | Center: (x, y) | Area: a"
+  CSV,         // header row, then one row per figure
+  JSON_LINES,  // one JSON object per figure
+};
+
+// Formats figures with std::to_chars into an internal buffer and hands it to the stream in
+// large blocks; writing a figure performs no allocation. TEXT output with all fields is
+// byte-identical to PrintAll under default stream flags. CSV and JSON_LINES print
+// floating-point values in shortest round-trip form.
+class FigureWriter {
+ public:
+  static constexpr unsigned VERTICES = 1u << 0;
+  static constexpr unsigned CENTER = 1u << 1;
+  static constexpr unsigned AREA = 1u << 2;
+  static constexpr unsigned ALL_FIELDS = VERTICES | CENTER | AREA;
+
+  static constexpr size_t DEFAULT_BUFFER_SIZE = 1 << 16;
+
+  explicit FigureWriter(std::ostream& os, OutputFormat format = OutputFormat::TEXT,
+                        unsigned fields = ALL_FIELDS, size_t buffer_size = DEFAULT_BUFFER_SIZE);
+  FigureWriter(const FigureWriter&) = delete;
+  FigureWriter& operator=(const FigureWriter&) = delete;
+  // Flushes what is still buffered; call Flush() explicitly to observe stream errors.
+  ~FigureWriter();
+
+  template <typename Figure>
+  void Write(const FigureArray<Figure>& figures);
+  // `index` is the element number printed in the record. The CSV header row is written
+  // before the first record.
+  template <typename Figure>
+  void Write(size_t index, const Figure& figure);
+
+  void Flush();
+
+ private:
+  // Upper bound on the bytes one record can take: four vertices, a center and an area,
+  // each number at most a few dozen characters.
+  static constexpr size_t MAX_RECORD_SIZE = 1024;
+
+  template <typename Figure>
+  void WriteText(size_t index, const Figure& figure);
+  template <typename Figure>
+  void WriteCsv(size_t index, const Figure& figure);
+  template <typename Figure>
+  void WriteJson(size_t index, const Figure& figure);
+
+  void WriteCsvHeader(size_t vertex_count);
+  void Reserve(size_t bytes);
+  void Append(std::string_view text);
+  void Append(char c);
+  template <Scalar T>
+  void AppendNumber(T value);
+  template <Scalar T>
+  void AppendPoint(const Point<T>& point, std::string_view open, std::string_view separator,
+                   std::string_view close);
+
+  std::ostream* os_;
+  OutputFormat format_;
+  unsigned fields_;
+  bool header_written_;
+  size_t capacity_;
+  size_t size_;
+  std::unique_ptr<char[]> buffer_;
+};
+
+template <typename Figure>
+void WriteFigures(std::ostream& os, const FigureArray<Figure>& figures,
+                  OutputFormat format = OutputFormat::TEXT,
+                  unsigned fields = FigureWriter::ALL_FIELDS);
+
+}  // namespace geometry
+
+#include "figure_writer.ipp"
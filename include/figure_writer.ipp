@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+namespace geometry {
+
+inline FigureWriter::FigureWriter(std::ostream& os, OutputFormat format, unsigned fields,
+                                  size_t buffer_size)
+    : os_(&os),
+      format_(format),
+      fields_(fields & ALL_FIELDS),
+      header_written_(false),
+      capacity_(std::max(buffer_size, MAX_RECORD_SIZE)),
+      size_(0),
+      buffer_(new char[capacity_]) {
+}
+
+inline FigureWriter::~FigureWriter() {
+  try {
+    Flush();
+  } catch (...) {
+    // Destructors must not throw; a stream configured to throw reports through Flush().
+  }
+}
+
+template <typename Figure>
+void FigureWriter::Write(const FigureArray<Figure>& figures) {
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    Write(i, figures[i]);
+  }
+}
+
+template <typename Figure>
+void FigureWriter::Write(size_t index, const Figure& figure) {
+  switch (format_) {
+    case OutputFormat::TEXT:
+      WriteText(index, figure);
+      break;
+    case OutputFormat::CSV:
+      WriteCsv(index, figure);
+      break;
+    case OutputFormat::JSON_LINES:
+      WriteJson(index, figure);
+      break;
+  }
+}
+
+inline void FigureWriter::Flush() {
+  if (size_ > 0) {
+    os_->write(buffer_.get(), static_cast<std::streamsize>(size_));
+    size_ = 0;
+  }
+  os_->flush();
+}
+
+template <typename Figure>
+void FigureWriter::WriteText(size_t index, const Figure& figure) {
+  Reserve(MAX_RECORD_SIZE);
+  Append("Element ");
+  AppendNumber(index);
+  Append(": ");
+  bool first_field = true;
+  if (fields_ & VERTICES) {
+    for (size_t k = 0; k < figure.GetVertexCount(); ++k) {
+      if (k > 0) {
+        Append(' ');
+      }
+      AppendPoint(figure.GetVertex(k), "(", ", ", ")");
+    }
+    first_field = false;
+  }
+  if (fields_ & CENTER) {
+    Append(first_field ? "Center: " : " | Center: ");
+    AppendPoint(figure.GetCenter(), "(", ", ", ")");
+    first_field = false;
+  }
+  if (fields_ & AREA) {
+    Append(first_field ? "Area: " : " | Area: ");
+    AppendNumber(static_cast<double>(figure));
+  }
+  Append('\n');
+}
+
+template <typename Figure>
+void FigureWriter::WriteCsv(size_t index, const Figure& figure) {
+  if (!header_written_) {
+    WriteCsvHeader(figure.GetVertexCount());
+    header_written_ = true;
+  }
+  Reserve(MAX_RECORD_SIZE);
+  AppendNumber(index);
+  if (fields_ & VERTICES) {
+    for (size_t k = 0; k < figure.GetVertexCount(); ++k) {
+      AppendPoint(figure.GetVertex(k), ",", ",", "");
+    }
+  }
+  if (fields_ & CENTER) {
+    AppendPoint(figure.GetCenter(), ",", ",", "");
+  }
+  if (fields_ & AREA) {
+    Append(',');
+    AppendNumber(static_cast<double>(figure));
+  }
+  Append('\n');
+}
+
+template <typename Figure>
+void FigureWriter::WriteJson(size_t index, const Figure& figure) {
+  Reserve(MAX_RECORD_SIZE);
+  Append("{\"index\":");
+  AppendNumber(index);
+  if (fields_ & VERTICES) {
+    Append(",\"vertices\":[");
+    for (size_t k = 0; k < figure.GetVertexCount(); ++k) {
+      if (k > 0) {
+        Append(',');
+      }
+      AppendPoint(figure.GetVertex(k), "[", ",", "]");
+    }
+    Append(']');
+  }
+  if (fields_ & CENTER) {
+    Append(",\"center\":");
+    AppendPoint(figure.GetCenter(), "[", ",", "]");
+  }
+  if (fields_ & AREA) {
+    Append(",\"area\":");
+    AppendNumber(static_cast<double>(figure));
+  }
+  Append("}\n");
+}
+
+inline void FigureWriter::WriteCsvHeader(size_t vertex_count) {
+  Reserve(MAX_RECORD_SIZE);
+  Append("index");
+  if (fields_ & VERTICES) {
+    for (size_t k = 1; k <= vertex_count; ++k) {
+      Append(",x");
+      AppendNumber(k);
+      Append(",y");
+      AppendNumber(k);
+    }
+  }
+  if (fields_ & CENTER) {
+    Append(",center_x,center_y");
+  }
+  if (fields_ & AREA) {
+    Append(",area");
+  }
+  Append('\n');
+}
+
+inline void FigureWriter::Reserve(size_t bytes) {
+  if (capacity_ - size_ < bytes) {
+    os_->write(buffer_.get(), static_cast<std::streamsize>(size_));
+    size_ = 0;
+  }
+}
+
+inline void FigureWriter::Append(std::string_view text) {
+  std::memcpy(buffer_.get() + size_, text.data(), text.size());
+  size_ += text.size();
+}
+
+inline void FigureWriter::Append(char c) {
+  buffer_[size_++] = c;
+}
+
+template <Scalar T>
+void FigureWriter::AppendNumber(T value) {
+  char* first = buffer_.get() + size_;
+  char* last = buffer_.get() + capacity_;
+  std::to_chars_result result{};
+  if constexpr (std::is_floating_point_v<T>) {
+    if (format_ == OutputFormat::JSON_LINES && !std::isfinite(value)) {
+      Append("null");
+      return;
+    }
+    if (format_ == OutputFormat::TEXT) {
+      // Same digits as an ostream with default flags (%g, precision 6).
+      result = std::to_chars(first, last, value, std::chars_format::general, 6);
+    } else {
+      result = std::to_chars(first, last, value);
+    }
+  } else {
+    result = std::to_chars(first, last, value);
+  }
+  size_ = static_cast<size_t>(result.ptr - buffer_.get());
+}
+
+template <Scalar T>
+void FigureWriter::AppendPoint(const Point<T>& point, std::string_view open,
+                               std::string_view separator, std::string_view close) {
+  Append(open);
+  AppendNumber(point.x);
+  Append(separator);
+  AppendNumber(point.y);
+  Append(close);
+}
+
+template <typename Figure>
+void WriteFigures(std::ostream& os, const FigureArray<Figure>& figures, OutputFormat format,
+                  unsigned fields) {
+  FigureWriter writer(os, format, fields);
+  writer.Write(figures);
+  writer.Flush();
+}
+
+}  // namespace geometry
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace geometry {
+
+// Pool of equally sized blocks carved out of large upstream chunks. Requests that fit a
+// block are served from a free list; larger or over-aligned requests go to the upstream
+// resource. Memory is returned to upstream only by Release() or destruction, so a batch of
+// shapes can be torn down in one shot. Not thread-safe: use one resource per thread.
+class FixedBlockResource : public std::pmr::memory_resource {
+ public:
+  static constexpr size_t DEFAULT_BLOCKS_PER_CHUNK = 1024;
+
+  FixedBlockResource(size_t block_size, size_t block_alignment,
+                     size_t blocks_per_chunk = DEFAULT_BLOCKS_PER_CHUNK,
+                     std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+  FixedBlockResource(const FixedBlockResource&) = delete;
+  FixedBlockResource& operator=(const FixedBlockResource&) = delete;
+  ~FixedBlockResource() override;
+
+  void Release();
+
+  size_t BlockSize() const;
+  size_t ChunkCount() const;
+  std::pmr::memory_resource* Upstream() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  struct Chunk {
+    Chunk* next;
+  };
+
+  bool Fits(size_t bytes, size_t alignment) const;
+  size_t HeaderSize() const;
+  size_t ChunkBytes() const;
+  size_t ChunkAlignment() const;
+  void AllocateChunk();
+
+  size_t block_size_;
+  size_t block_alignment_;
+  size_t blocks_per_chunk_;
+  std::pmr::memory_resource* upstream_;
+  FreeBlock* free_list_;
+  Chunk* chunks_;
+  size_t chunk_count_;
+};
+
+// Pool whose blocks are sized and aligned for objects of type T, e.g. Point<T> or a shape.
+template <typename T>
+FixedBlockResource MakeBlockResourceFor(
+    size_t blocks_per_chunk = FixedBlockResource::DEFAULT_BLOCKS_PER_CHUNK,
+    std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+}  // namespace geometry
+
+#include "fixed_block_resource.ipp"
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+namespace geometry {
+
+inline FixedBlockResource::FixedBlockResource(size_t block_size, size_t block_alignment,
+                                              size_t blocks_per_chunk,
+                                              std::pmr::memory_resource* upstream)
+    : block_size_(0),
+      block_alignment_(std::max(block_alignment, alignof(FreeBlock))),
+      blocks_per_chunk_(blocks_per_chunk),
+      upstream_(upstream),
+      free_list_(nullptr),
+      chunks_(nullptr),
+      chunk_count_(0) {
+  if (block_size == 0 || blocks_per_chunk == 0 || upstream == nullptr) {
+    throw std::invalid_argument("FixedBlockResource needs a block size, chunk size and upstream");
+  }
+  if ((block_alignment_ & (block_alignment_ - 1)) != 0) {
+    throw std::invalid_argument("Block alignment must be a power of two");
+  }
+  size_t size = std::max(block_size, sizeof(FreeBlock));
+  block_size_ = (size + block_alignment_ - 1) / block_alignment_ * block_alignment_;
+}
+
+inline FixedBlockResource::~FixedBlockResource() {
+  Release();
+}
+
+inline void FixedBlockResource::Release() {
+  while (chunks_ != nullptr) {
+    Chunk* next = chunks_->next;
+    upstream_->deallocate(chunks_, ChunkBytes(), ChunkAlignment());
+    chunks_ = next;
+  }
+  free_list_ = nullptr;
+  chunk_count_ = 0;
+}
+
+inline size_t FixedBlockResource::BlockSize() const {
+  return block_size_;
+}
+
+inline size_t FixedBlockResource::ChunkCount() const {
+  return chunk_count_;
+}
+
+inline std::pmr::memory_resource* FixedBlockResource::Upstream() const {
+  return upstream_;
+}
+
+inline void* FixedBlockResource::do_allocate(size_t bytes, size_t alignment) {
+  if (!Fits(bytes, alignment)) {
+    return upstream_->allocate(bytes, alignment);
+  }
+  if (free_list_ == nullptr) {
+    AllocateChunk();
+  }
+  FreeBlock* block = free_list_;
+  free_list_ = block->next;
+  return block;
+}
+
+inline void FixedBlockResource::do_deallocate(void* p, size_t bytes, size_t alignment) {
+  if (!Fits(bytes, alignment)) {
+    upstream_->deallocate(p, bytes, alignment);
+    return;
+  }
+  free_list_ = ::new (p) FreeBlock{free_list_};
+}
+
+inline bool FixedBlockResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+inline bool FixedBlockResource::Fits(size_t bytes, size_t alignment) const {
+  return bytes <= block_size_ && alignment <= block_alignment_;
+}
+
+inline size_t FixedBlockResource::HeaderSize() const {
+  return (sizeof(Chunk) + block_alignment_ - 1) / block_alignment_ * block_alignment_;
+}
+
+inline size_t FixedBlockResource::ChunkBytes() const {
+  return HeaderSize() + block_size_ * blocks_per_chunk_;
+}
+
+inline size_t FixedBlockResource::ChunkAlignment() const {
+  return std::max(block_alignment_, alignof(Chunk));
+}
+
+inline void FixedBlockResource::AllocateChunk() {
+  void* memory = upstream_->allocate(ChunkBytes(), ChunkAlignment());
+  Chunk* chunk = ::new (memory) Chunk{chunks_};
+  chunks_ = chunk;
+  ++chunk_count_;
+
+  char* blocks = reinterpret_cast<char*>(chunk) + HeaderSize();
+  for (size_t i = blocks_per_chunk_; i > 0; --i) {
+    free_list_ = ::new (blocks + (i - 1) * block_size_) FreeBlock{free_list_};
+  }
+}
+
+template <typename T>
+FixedBlockResource MakeBlockResourceFor(size_t blocks_per_chunk,
+                                        std::pmr::memory_resource* upstream) {
+  return FixedBlockResource(sizeof(T), alignof(T), blocks_per_chunk, upstream);
+}
+
+}  // namespace geometry
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Build with -DGEOMETRY_INSTRUMENTATION=1 to count allocations, element moves and copies,
+// reallocations and area/center calls per FigureArray and shape type, and to enable
+// ScopedTimer. When it is 0 (the default) every hook is an empty inline function and the
+// tracking members take no space. All translation units of one binary must agree on it.
+#ifndef GEOMETRY_INSTRUMENTATION
+#define GEOMETRY_INSTRUMENTATION 0
+#endif
+
+namespace geometry {
+
+inline constexpr bool INSTRUMENTATION_ENABLED = GEOMETRY_INSTRUMENTATION != 0;
+
+enum class Counter : uint8_t {
+  ALLOCATIONS,      // element buffers obtained from the memory resource
+  ALLOCATED_BYTES,  // their total size
+  DEALLOCATIONS,
+  REALLOCATIONS,    // buffers replaced by a new one: growth, Reserve, ShrinkToFit, ...
+  MOVES,            // elements moved or relocated, including memmove shifts
+  COPIES,           // elements copy-constructed or copy-assigned
+  AREA_CALLS,       // operator double()
+  CENTER_CALLS,     // GetCenter()
+};
+
+inline constexpr size_t COUNTER_COUNT = 8;
+
+struct CounterSnapshot {
+  uint64_t allocations = 0;
+  uint64_t allocated_bytes = 0;
+  uint64_t deallocations = 0;
+  uint64_t reallocations = 0;
+  uint64_t moves = 0;
+  uint64_t copies = 0;
+  uint64_t area_calls = 0;
+  uint64_t center_calls = 0;
+
+  // Counts accumulated between `earlier` and this snapshot.
+  CounterSnapshot operator-(const CounterSnapshot& earlier) const;
+  bool operator==(const CounterSnapshot& other) const = default;
+};
+
+struct TimerSnapshot {
+  uint64_t calls = 0;
+  std::chrono::nanoseconds total{0};
+};
+
+namespace instrumentation {
+
+// Relaxed atomic counters of one instrumented type.
+class CounterSet {
+ public:
+  void Add(Counter counter, uint64_t amount);
+  CounterSnapshot Snapshot() const;
+  void Reset();
+
+ private:
+  std::array<std::atomic<uint64_t>, COUNTER_COUNT> values_{};
+};
+
+struct TimerSet {
+  std::atomic<uint64_t> calls{0};
+  std::atomic<int64_t> nanoseconds{0};
+};
+
+// Counters for Owner, registered under its type name on first use.
+template <typename Owner>
+CounterSet& CountersFor();
+
+template <typename Owner>
+void Record(Counter counter, uint64_t amount = 1);
+
+// Empty member that attributes copies and moves of its enclosing object to Owner. Declare
+// it [[no_unique_address]] so it adds no size; with instrumentation off it is trivial. Its
+// operations stay noexcept so the enclosing type keeps its exception guarantees.
+template <typename Owner, bool ENABLED = INSTRUMENTATION_ENABLED>
+struct CopyMoveTracker {};
+
+template <typename Owner>
+struct CopyMoveTracker<Owner, true> {
+  CopyMoveTracker() = default;
+  CopyMoveTracker(const CopyMoveTracker&) noexcept;
+  CopyMoveTracker(CopyMoveTracker&&) noexcept;
+  CopyMoveTracker& operator=(const CopyMoveTracker&) noexcept;
+  CopyMoveTracker& operator=(CopyMoveTracker&&) noexcept;
+};
+
+std::string DemangledName(const char* mangled);
+
+}  // namespace instrumentation
+
+template <typename Owner>
+CounterSnapshot SnapshotCounters();
+template <typename Owner>
+void ResetCounters();
+// Every type that recorded an event so far, by type name.
+std::vector<std::pair<std::string, CounterSnapshot>> SnapshotAllCounters();
+void ResetAllCounters();
+
+// Adds the lifetime of the object to the timer `name`: one call and the elapsed steady-clock
+// time. Looking the timer up takes a lock, so time regions of microseconds or more.
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(std::string_view name);
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+  ~ScopedTimer();
+
+ private:
+  struct Running {
+    instrumentation::TimerSet* timer;
+    std::chrono::steady_clock::time_point start;
+  };
+  struct Idle {};
+
+  [[no_unique_address]] std::conditional_t<INSTRUMENTATION_ENABLED, Running, Idle> state_;
+};
+
+TimerSnapshot SnapshotTimer(std::string_view name);
+std::vector<std::pair<std::string, TimerSnapshot>> SnapshotAllTimers();
+void ResetAllTimers();
+
+}  // namespace geometry
+
+#include "instrumentation.ipp"
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <typeinfo>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+
+#include <cstdlib>
+#include <memory>
+#endif
+
+namespace geometry {
+
+inline CounterSnapshot CounterSnapshot::operator-(const CounterSnapshot& earlier) const {
+  CounterSnapshot difference;
+  difference.allocations = allocations - earlier.allocations;
+  difference.allocated_bytes = allocated_bytes - earlier.allocated_bytes;
+  difference.deallocations = deallocations - earlier.deallocations;
+  difference.reallocations = reallocations - earlier.reallocations;
+  difference.moves = moves - earlier.moves;
+  difference.copies = copies - earlier.copies;
+  difference.area_calls = area_calls - earlier.area_calls;
+  difference.center_calls = center_calls - earlier.center_calls;
+  return difference;
+}
+
+namespace instrumentation {
+
+inline void CounterSet::Add(Counter counter, uint64_t amount) {
+  values_[static_cast<size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+}
+
+inline CounterSnapshot CounterSet::Snapshot() const {
+  auto load = [this](Counter counter) {
+    return values_[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+  };
+  CounterSnapshot snapshot;
+  snapshot.allocations = load(Counter::ALLOCATIONS);
+  snapshot.allocated_bytes = load(Counter::ALLOCATED_BYTES);
+  snapshot.deallocations = load(Counter::DEALLOCATIONS);
+  snapshot.reallocations = load(Counter::REALLOCATIONS);
+  snapshot.moves = load(Counter::MOVES);
+  snapshot.copies = load(Counter::COPIES);
+  snapshot.area_calls = load(Counter::AREA_CALLS);
+  snapshot.center_calls = load(Counter::CENTER_CALLS);
+  return snapshot;
+}
+
+inline void CounterSet::Reset() {
+  for (std::atomic<uint64_t>& value : values_) {
+    value.store(0, std::memory_order_relaxed);
+  }
+}
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::pair<std::string, CounterSet*>> counters;
+  std::map<std::string, TimerSet, std::less<>> timers;
+};
+
+inline Registry& GetRegistry() {
+  static Registry registry;
+  return registry;
+}
+
+inline std::string DemangledName(const char* mangled) {
+#if defined(__GNUG__)
+  int status = 0;
+  std::unique_ptr<char, void (*)(void*)> name(
+      abi::__cxa_demangle(mangled, nullptr, nullptr, &status), std::free);
+  if (status == 0 && name) {
+    return name.get();
+  }
+#endif
+  return mangled;
+}
+
+template <typename Owner>
+CounterSet& CountersFor() {
+  static CounterSet counters;
+  static const bool registered = [] {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.counters.emplace_back(DemangledName(typeid(Owner).name()), &counters);
+    return true;
+  }();
+  static_cast<void>(registered);
+  return counters;
+}
+
+template <typename Owner>
+void Record(Counter counter, uint64_t amount) {
+  if constexpr (INSTRUMENTATION_ENABLED) {
+    CountersFor<Owner>().Add(counter, amount);
+  }
+}
+
+template <typename Owner>
+CopyMoveTracker<Owner, true>::CopyMoveTracker(const CopyMoveTracker&) noexcept {
+  Record<Owner>(Counter::COPIES);
+}
+
+template <typename Owner>
+CopyMoveTracker<Owner, true>::CopyMoveTracker(CopyMoveTracker&&) noexcept {
+  Record<Owner>(Counter::MOVES);
+}
+
+template <typename Owner>
+CopyMoveTracker<Owner, true>& CopyMoveTracker<Owner, true>::operator=(
+    const CopyMoveTracker&) noexcept {
+  Record<Owner>(Counter::COPIES);
+  return *this;
+}
+
+template <typename Owner>
+CopyMoveTracker<Owner, true>& CopyMoveTracker<Owner, true>::operator=(
+    CopyMoveTracker&&) noexcept {
+  Record<Owner>(Counter::MOVES);
+  return *this;
+}
+
+}  // namespace instrumentation
+
+template <typename Owner>
+CounterSnapshot SnapshotCounters() {
+  if constexpr (INSTRUMENTATION_ENABLED) {
+    return instrumentation::CountersFor<Owner>().Snapshot();
+  } else {
+    return CounterSnapshot();
+  }
+}
+
+template <typename Owner>
+void ResetCounters() {
+  if constexpr (INSTRUMENTATION_ENABLED) {
+    instrumentation::CountersFor<Owner>().Reset();
+  }
+}
+
+inline std::vector<std::pair<std::string, CounterSnapshot>> SnapshotAllCounters() {
+  instrumentation::Registry& registry = instrumentation::GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  std::vector<std::pair<std::string, CounterSnapshot>> snapshots;
+  snapshots.reserve(registry.counters.size());
+  for (const auto& [name, counters] : registry.counters) {
+    snapshots.emplace_back(name, counters->Snapshot());
+  }
+  return snapshots;
+}
+
+inline void ResetAllCounters() {
+  instrumentation::Registry& registry = instrumentation::GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto& entry : registry.counters) {
+    entry.second->Reset();
+  }
+}
+
+#if GEOMETRY_INSTRUMENTATION
+
+inline ScopedTimer::ScopedTimer(std::string_view name) {
+  instrumentation::Registry& registry = instrumentation::GetRegistry();
+  {
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto it = registry.timers.find(name);
+    if (it == registry.timers.end()) {
+      it = registry.timers.try_emplace(std::string(name)).first;
+    }
+    state_.timer = &it->second;
+  }
+  state_.start = std::chrono::steady_clock::now();
+}
+
+inline ScopedTimer::~ScopedTimer() {
+  auto elapsed = std::chrono::steady_clock::now() - state_.start;
+  state_.timer->calls.fetch_add(1, std::memory_order_relaxed);
+  state_.timer->nanoseconds.fetch_add(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+      std::memory_order_relaxed);
+}
+
+#else
+
+inline ScopedTimer::ScopedTimer(std::string_view) {
+}
+
+inline ScopedTimer::~ScopedTimer() {
+}
+
+#endif  // GEOMETRY_INSTRUMENTATION
+
+inline TimerSnapshot SnapshotTimer(std::string_view name) {
+  instrumentation::Registry& registry = instrumentation::GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  TimerSnapshot snapshot;
+  auto it = registry.timers.find(name);
+  if (it != registry.timers.end()) {
+    snapshot.calls = it->second.calls.load(std::memory_order_relaxed);
+    snapshot.total =
+        std::chrono::nanoseconds(it->second.nanoseconds.load(std::memory_order_relaxed));
+  }
+  return snapshot;
+}
+
+inline std::vector<std::pair<std::string, TimerSnapshot>> SnapshotAllTimers() {
+  instrumentation::Registry& registry = instrumentation::GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  std::vector<std::pair<std::string, TimerSnapshot>> snapshots;
+  snapshots.reserve(registry.timers.size());
+  for (const auto& [name, timer] : registry.timers) {
+    TimerSnapshot snapshot;
+    snapshot.calls = timer.calls.load(std::memory_order_relaxed);
+    snapshot.total = std::chrono::nanoseconds(timer.nanoseconds.load(std::memory_order_relaxed));
+    snapshots.emplace_back(name, snapshot);
+  }
+  return snapshots;
+}
+
+inline void ResetAllTimers() {
+  instrumentation::Registry& registry = instrumentation::GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto& entry : registry.timers) {
+    entry.second.calls.store(0, std::memory_order_relaxed);
+    entry.second.nanoseconds.store(0, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace geometry
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+namespace geometry {
+
+// Arithmetic types that map to 64-bit sort keys without losing order.
+template <typename Key>
+concept RadixSortable = std::is_arithmetic_v<Key> && sizeof(Key) <= sizeof(uint64_t);
+
+namespace sorting {
+
+// Element index paired with its key mapped by OrderedBits; pairs compare key first.
+using SortEntry = std::pair<uint64_t, size_t>;
+
+// Maps `key` to an unsigned integer with the same order: signed values are biased, IEEE
+// values have their sign-magnitude bits flipped. -0.0 maps like 0.0 and every NaN maps to
+// the largest value, so NaN keys sort last and equal keys tie.
+template <RadixSortable Key>
+uint64_t OrderedBits(Key key);
+// Same, in descending key order; NaN keys still map to the largest value.
+template <RadixSortable Key>
+uint64_t ReverseOrderedBits(Key key);
+
+// Stable LSD radix sort by key, one byte per pass; passes in which every key shares the
+// byte are skipped. Entries that start in index order therefore end ordered by (key, index).
+void RadixSort(std::vector<SortEntry>& entries);
+// Same result; each pass histograms and scatters RADIX_CHUNK_SIZE pieces concurrently.
+void RadixSort(std::vector<SortEntry>& entries, ThreadPool& pool);
+
+inline constexpr size_t RADIX_CHUNK_SIZE = 1 << 16;
+
+}  // namespace sorting
+
+}  // namespace geometry
+
+#include "key_sort.ipp"
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace geometry {
+
+namespace sorting {
+
+template <RadixSortable Key>
+uint64_t OrderedBits(Key key) {
+  constexpr uint64_t SIGN = uint64_t{1} << 63;
+  if constexpr (std::is_floating_point_v<Key>) {
+    double value = static_cast<double>(key);
+    if (std::isnan(value)) {
+      return std::numeric_limits<uint64_t>::max();
+    }
+    uint64_t bits = std::bit_cast<uint64_t>(value == 0.0 ? 0.0 : value);
+    return (bits & SIGN) != 0 ? ~bits : bits | SIGN;
+  } else if constexpr (std::is_signed_v<Key>) {
+    return static_cast<uint64_t>(static_cast<int64_t>(key)) ^ SIGN;
+  } else {
+    return static_cast<uint64_t>(key);
+  }
+}
+
+template <RadixSortable Key>
+uint64_t ReverseOrderedBits(Key key) {
+  uint64_t bits = OrderedBits(key);
+  if constexpr (std::is_floating_point_v<Key>) {
+    if (std::isnan(key)) {
+      return bits;
+    }
+  }
+  // No number maps to 0, so no number maps to the NaN value here.
+  return ~bits;
+}
+
+inline constexpr size_t RADIX_BUCKETS = 256;
+inline constexpr size_t RADIX_PASSES = sizeof(uint64_t);
+
+using RadixHistogram = std::array<size_t, RADIX_BUCKETS>;
+
+// Runs body(chunk) for every chunk, on the pool when there is one.
+template <typename Body>
+void ForEachChunk(size_t chunks, ThreadPool* pool, Body body) {
+  if (pool != nullptr) {
+    pool->ParallelFor(chunks, body);
+  } else {
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+      body(chunk);
+    }
+  }
+}
+
+inline void SortEntries(std::vector<SortEntry>& entries, ThreadPool* pool) {
+  size_t size = entries.size();
+  if (size < 2) {
+    return;
+  }
+  size_t chunks = (size + RADIX_CHUNK_SIZE - 1) / RADIX_CHUNK_SIZE;
+  std::vector<RadixHistogram> histograms(chunks);
+  std::vector<SortEntry> buffer(size);
+  SortEntry* from = entries.data();
+  SortEntry* to = buffer.data();
+
+  for (size_t pass = 0; pass < RADIX_PASSES; ++pass) {
+    unsigned shift = static_cast<unsigned>(pass * 8);
+    ForEachChunk(chunks, pool, [&](size_t chunk) {
+      RadixHistogram& counts = histograms[chunk];
+      counts.fill(0);
+      size_t end = std::min((chunk + 1) * RADIX_CHUNK_SIZE, size);
+      for (size_t i = chunk * RADIX_CHUNK_SIZE; i < end; ++i) {
+        ++counts[(from[i].first >> shift) & 0xFF];
+      }
+    });
+
+    // Turn counts into scatter offsets: digit-major, then chunk order, which keeps the
+    // pass stable.
+    size_t offset = 0;
+    bool single_digit = false;
+    for (size_t digit = 0; digit < RADIX_BUCKETS; ++digit) {
+      size_t digit_begin = offset;
+      for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        size_t count = histograms[chunk][digit];
+        histograms[chunk][digit] = offset;
+        offset += count;
+      }
+      single_digit = single_digit || offset - digit_begin == size;
+    }
+    if (single_digit) {
+      continue;
+    }
+
+    ForEachChunk(chunks, pool, [&](size_t chunk) {
+      RadixHistogram& next = histograms[chunk];
+      size_t end = std::min((chunk + 1) * RADIX_CHUNK_SIZE, size);
+      for (size_t i = chunk * RADIX_CHUNK_SIZE; i < end; ++i) {
+        to[next[(from[i].first >> shift) & 0xFF]++] = from[i];
+      }
+    });
+    std::swap(from, to);
+  }
+  if (from != entries.data()) {
+    entries.swap(buffer);
+  }
+}
+
+inline void RadixSort(std::vector<SortEntry>& entries) {
+  SortEntries(entries, nullptr);
+}
+
+inline void RadixSort(std::vector<SortEntry>& entries, ThreadPool& pool) {
+  SortEntries(entries, &pool);
+}
+
+}  // namespace sorting
+
+}  // namespace geometry
@@ -1,38 +1,27 @@
 #pragma once
 
+#include <stdexcept>
+
 namespace geometry {
 
 template <Scalar T>
-Rectangle<T>::Rectangle() {
-  for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-    vertices_[i] = std::make_unique<Point<T>>();
-  }
+Rectangle<T>::Rectangle() : vertices_{}, cache_() {
 }
 
 template <Scalar T>
 Rectangle<T>::Rectangle(const Point<T>& p1, const Point<T>& p2, const Point<T>& p3,
-                        const Point<T>& p4) {
-  vertices_[0] = std::make_unique<Point<T>>(p1);
-  vertices_[1] = std::make_unique<Point<T>>(p2);
-  vertices_[2] = std::make_unique<Point<T>>(p3);
-  vertices_[3] = std::make_unique<Point<T>>(p4);
-}
-
-template <Scalar T>
-Rectangle<T>::Rectangle(const Rectangle& other) {
-  for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-    vertices_[i] = std::make_unique<Point<T>>(*other.vertices_[i]);
-  }
+                        const Point<T>& p4)
+    : vertices_{p1, p2, p3, p4}, cache_() {
 }
 
 template <Scalar T>
-Rectangle<T>& Rectangle<T>::operator=(const Rectangle& other) {
-  if (this != &other) {
-    for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-      vertices_[i] = std::make_unique<Point<T>>(*other.vertices_[i]);
-    }
+Rectangle<T>::Rectangle(StrictTag, const Point<T>& p1, const Point<T>& p2, const Point<T>& p3,
+                        const Point<T>& p4)
+    : Rectangle(p1, p2, p3, p4) {
+  uint8_t defects = Validate();
+  if (defects != 0) {
+    throw InvalidShapeError("rectangle", defects);
   }
-  return *this;
 }
 
 template <Scalar T>
@@ -41,7 +30,7 @@ bool Rectangle<T>::operator==(const Rectangle& other) const {
     return false;
   }
   for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-    if (*vertices_[i] != *other.vertices_[i]) {
+    if (vertices_[i] != other.vertices_[i]) {
       return false;
     }
   }
@@ -53,30 +42,103 @@ size_t Rectangle<T>::GetVertexCount() const {
   return VERTEX_COUNT;
 }
 
+template <Scalar T>
+const Point<T>& Rectangle<T>::GetVertex(size_t index) const {
+  if (index >= VERTEX_COUNT) {
+    throw std::out_of_range("Vertex index out of range");
+  }
+  return vertices_[index];
+}
+
+template <Scalar T>
+void Rectangle<T>::SetVertex(size_t index, const Point<T>& vertex) {
+  if (index >= VERTEX_COUNT) {
+    throw std::out_of_range("Vertex index out of range");
+  }
+  vertices_[index] = vertex;
+  cache_.Invalidate();
+}
+
+template <Scalar T>
+uint8_t Rectangle<T>::Validate() const {
+  return ValidateQuadrilateral<ShapeKind::RECTANGLE>(vertices_.data());
+}
+
+template <Scalar T>
+void Rectangle<T>::Transform(const AffineTransform& transform) {
+  Transform(PointTransformer<T>(transform));
+}
+
+template <Scalar T>
+void Rectangle<T>::Transform(const PointTransformer<T>& transformer) {
+  transformer(vertices_.data(), VERTEX_COUNT);
+  cache_.Invalidate();
+}
+
+template <Scalar T>
+void Rectangle<T>::Translate(double dx, double dy) {
+  Transform(AffineTransform::Translation(dx, dy));
+}
+
+template <Scalar T>
+void Rectangle<T>::Rotate(double radians) {
+  Transform(AffineTransform::Rotation(radians));
+}
+
+template <Scalar T>
+void Rectangle<T>::Scale(double sx, double sy) {
+  Transform(AffineTransform::Scaling(sx, sy));
+}
+
 template <Scalar T>
 Point<T> Rectangle<T>::GetCenter() const {
-  return Figure<T>::CalculateCenter(vertices_, VERTEX_COUNT);
+  instrumentation::Record<Rectangle>(Counter::CENTER_CALLS);
+  return cache_.Center(
+      [this] { return Figure<T>::CalculateCenter(vertices_.data(), VERTEX_COUNT); });
+}
+
+template <Scalar T>
+double Rectangle<T>::GetPerimeter() const {
+  return cache_.Perimeter(
+      [this] { return Figure<T>::CalculatePerimeter(vertices_.data(), VERTEX_COUNT); });
 }
 
 template <Scalar T>
 Rectangle<T>::operator double() const {
-  double side1 = vertices_[0]->DistanceTo(*vertices_[1]);
-  double side2 = vertices_[1]->DistanceTo(*vertices_[2]);
-  return side1 * side2;
+  instrumentation::Record<Rectangle>(Counter::AREA_CALLS);
+  return cache_.Area([this] { return CalculateArea(); });
+}
+
+template <Scalar T>
+Int128 Rectangle<T>::TwiceArea() const requires std::integral<T> {
+  Int128 twice = TwiceSignedArea(vertices_.data());
+  return twice < 0 ? -twice : twice;
+}
+
+template <Scalar T>
+double Rectangle<T>::CalculateArea() const {
+  if constexpr (std::integral<T>) {
+    return 0.5 * ToDouble(TwiceArea());
+  } else {
+    double side1 = vertices_[0].DistanceTo(vertices_[1]);
+    double side2 = vertices_[1].DistanceTo(vertices_[2]);
+    return side1 * side2;
+  }
 }
 
 template <Scalar T>
 std::istream& operator>>(std::istream& is, Rectangle<T>& rectangle) {
   for (size_t i = 0; i < rectangle.VERTEX_COUNT; ++i) {
-    is >> *rectangle.vertices_[i];
+    is >> rectangle.vertices_[i];
   }
+  rectangle.cache_.Invalidate();
   return is;
 }
 
 template <Scalar T>
 std::ostream& operator<<(std::ostream& os, const Rectangle<T>& rectangle) {
   for (size_t i = 0; i < rectangle.VERTEX_COUNT; ++i) {
-    os << *rectangle.vertices_[i];
+    os << rectangle.vertices_[i];
     if (i < rectangle.VERTEX_COUNT - 1) {
       os << " ";
     }
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <type_traits>
+
+namespace geometry {
+
+// Types whose objects can be moved to new storage with memcpy, leaving the source storage
+// dead without running its destructor. Shapes opt in next to their class definitions.
+template <typename T>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+}  // namespace geometry
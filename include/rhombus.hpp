@@ -1,25 +1,51 @@
 #pragma once
 
-#include <memory>
+#include <array>
+
+#include "affine_transform.hpp"
+#include "exact_area.hpp"
 #include "figure.hpp"
+#include "instrumentation.hpp"
+#include "relocation.hpp"
+#include "shape_cache.hpp"
+#include "shape_validation.hpp"
 
 namespace geometry {
 
 template <Scalar T>
-class Rhombus : public Figure<T> {
+class Rhombus final : public Figure<T> {
  public:
   Rhombus();
   Rhombus(const Point<T>& p1, const Point<T>& p2, const Point<T>& p3, const Point<T>& p4);
-  Rhombus(const Rhombus& other);
+  // Throws InvalidShapeError unless Validate() finds no defect.
+  Rhombus(StrictTag, const Point<T>& p1, const Point<T>& p2, const Point<T>& p3,
+          const Point<T>& p4);
+  Rhombus(const Rhombus& other) = default;
   Rhombus(Rhombus&& other) noexcept = default;
 
-  Rhombus& operator=(const Rhombus& other);
+  Rhombus& operator=(const Rhombus& other) = default;
   Rhombus& operator=(Rhombus&& other) noexcept = default;
   bool operator==(const Rhombus& other) const;
 
   Point<T> GetCenter() const override;
+  double GetPerimeter() const override;
+  // Integer shapes take the area from TwiceArea, without square roots.
   operator double() const override;
+  // Exact twice the area of integer shapes; see TwiceSignedArea for the coordinate range.
+  Int128 TwiceArea() const requires std::integral<T>;
   size_t GetVertexCount() const override;
+  const Point<T>& GetVertex(size_t index) const override;
+  void SetVertex(size_t index, const Point<T>& vertex);
+  // ShapeDefect bits describing how the vertices fail to form this shape; 0 if they do.
+  uint8_t Validate() const;
+
+  // Transforms every vertex in place; see RoundCoordinate for integer coordinates. Rotate
+  // and Scale act about the origin.
+  void Transform(const AffineTransform& transform);
+  void Transform(const PointTransformer<T>& transformer);
+  void Translate(double dx, double dy);
+  void Rotate(double radians);
+  void Scale(double sx, double sy);
 
   template <Scalar U>
   friend std::istream& operator>>(std::istream& is, Rhombus<U>& rhombus);
@@ -29,9 +55,17 @@ class Rhombus : public Figure<T> {
 
  private:
   static constexpr size_t VERTEX_COUNT = 4;
-  std::unique_ptr<Point<T>> vertices_[VERTEX_COUNT];
+
+  double CalculateArea() const;
+
+  std::array<Point<T>, VERTEX_COUNT> vertices_;
+  ShapeCache<T> cache_;
+  [[no_unique_address]] instrumentation::CopyMoveTracker<Rhombus> tracker_;
 };
 
+template <Scalar T>
+struct IsTriviallyRelocatable<Rhombus<T>> : std::true_type {};
+
 }  // namespace geometry
 
 #include "rhombus.ipp"
\ No newline at end of file
@@ -1,38 +1,27 @@
 #pragma once
 
+#include <stdexcept>
+
 namespace geometry {
 
 template <Scalar T>
-Rhombus<T>::Rhombus() {
-  for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-    vertices_[i] = std::make_unique<Point<T>>();
-  }
+Rhombus<T>::Rhombus() : vertices_{}, cache_() {
 }
 
 template <Scalar T>
 Rhombus<T>::Rhombus(const Point<T>& p1, const Point<T>& p2, const Point<T>& p3,
-                    const Point<T>& p4) {
-  vertices_[0] = std::make_unique<Point<T>>(p1);
-  vertices_[1] = std::make_unique<Point<T>>(p2);
-  vertices_[2] = std::make_unique<Point<T>>(p3);
-  vertices_[3] = std::make_unique<Point<T>>(p4);
-}
-
-template <Scalar T>
-Rhombus<T>::Rhombus(const Rhombus& other) {
-  for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-    vertices_[i] = std::make_unique<Point<T>>(*other.vertices_[i]);
-  }
+                    const Point<T>& p4)
+    : vertices_{p1, p2, p3, p4}, cache_() {
 }
 
 template <Scalar T>
-Rhombus<T>& Rhombus<T>::operator=(const Rhombus& other) {
-  if (this != &other) {
-    for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-      vertices_[i] = std::make_unique<Point<T>>(*other.vertices_[i]);
-    }
+Rhombus<T>::Rhombus(StrictTag, const Point<T>& p1, const Point<T>& p2, const Point<T>& p3,
+                    const Point<T>& p4)
+    : Rhombus(p1, p2, p3, p4) {
+  uint8_t defects = Validate();
+  if (defects != 0) {
+    throw InvalidShapeError("rhombus", defects);
   }
-  return *this;
 }
 
 template <Scalar T>
@@ -41,7 +30,7 @@ bool Rhombus<T>::operator==(const Rhombus& other) const {
     return false;
   }
   for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-    if (*vertices_[i] != *other.vertices_[i]) {
+    if (vertices_[i] != other.vertices_[i]) {
       return false;
     }
   }
@@ -53,30 +42,103 @@ size_t Rhombus<T>::GetVertexCount() const {
   return VERTEX_COUNT;
 }
 
+template <Scalar T>
+const Point<T>& Rhombus<T>::GetVertex(size_t index) const {
+  if (index >= VERTEX_COUNT) {
+    throw std::out_of_range("Vertex index out of range");
+  }
+  return vertices_[index];
+}
+
+template <Scalar T>
+void Rhombus<T>::SetVertex(size_t index, const Point<T>& vertex) {
+  if (index >= VERTEX_COUNT) {
+    throw std::out_of_range("Vertex index out of range");
+  }
+  vertices_[index] = vertex;
+  cache_.Invalidate();
+}
+
+template <Scalar T>
+uint8_t Rhombus<T>::Validate() const {
+  return ValidateQuadrilateral<ShapeKind::RHOMBUS>(vertices_.data());
+}
+
+template <Scalar T>
+void Rhombus<T>::Transform(const AffineTransform& transform) {
+  Transform(PointTransformer<T>(transform));
+}
+
+template <Scalar T>
+void Rhombus<T>::Transform(const PointTransformer<T>& transformer) {
+  transformer(vertices_.data(), VERTEX_COUNT);
+  cache_.Invalidate();
+}
+
+template <Scalar T>
+void Rhombus<T>::Translate(double dx, double dy) {
+  Transform(AffineTransform::Translation(dx, dy));
+}
+
+template <Scalar T>
+void Rhombus<T>::Rotate(double radians) {
+  Transform(AffineTransform::Rotation(radians));
+}
+
+template <Scalar T>
+void Rhombus<T>::Scale(double sx, double sy) {
+  Transform(AffineTransform::Scaling(sx, sy));
+}
+
 template <Scalar T>
 Point<T> Rhombus<T>::GetCenter() const {
-  return Figure<T>::CalculateCenter(vertices_, VERTEX_COUNT);
+  instrumentation::Record<Rhombus>(Counter::CENTER_CALLS);
+  return cache_.Center(
+      [this] { return Figure<T>::CalculateCenter(vertices_.data(), VERTEX_COUNT); });
+}
+
+template <Scalar T>
+double Rhombus<T>::GetPerimeter() const {
+  return cache_.Perimeter(
+      [this] { return Figure<T>::CalculatePerimeter(vertices_.data(), VERTEX_COUNT); });
 }
 
 template <Scalar T>
 Rhombus<T>::operator double() const {
-  double d1 = vertices_[0]->DistanceTo(*vertices_[2]);
-  double d2 = vertices_[1]->DistanceTo(*vertices_[3]);
-  return (d1 * d2) / 2.0;
+  instrumentation::Record<Rhombus>(Counter::AREA_CALLS);
+  return cache_.Area([this] { return CalculateArea(); });
+}
+
+template <Scalar T>
+Int128 Rhombus<T>::TwiceArea() const requires std::integral<T> {
+  Int128 twice = TwiceSignedArea(vertices_.data());
+  return twice < 0 ? -twice : twice;
+}
+
+template <Scalar T>
+double Rhombus<T>::CalculateArea() const {
+  if constexpr (std::integral<T>) {
+    return 0.5 * ToDouble(TwiceArea());
+  } else {
+    double d1 = vertices_[0].DistanceTo(vertices_[2]);
+    double d2 = vertices_[1].DistanceTo(vertices_[3]);
+    return (d1 * d2) / 2.0;
+  }
 }
 
 template <Scalar T>
 std::istream& operator>>(std::istream& is, Rhombus<T>& rhombus) {
   for (size_t i = 0; i < rhombus.VERTEX_COUNT; ++i) {
-    is >> *rhombus.vertices_[i];
+    is >> rhombus.vertices_[i];
   }
+  rhombus.cache_.Invalidate();
   return is;
 }
 
 template <Scalar T>
 std::ostream& operator<<(std::ostream& os, const Rhombus<T>& rhombus) {
   for (size_t i = 0; i < rhombus.VERTEX_COUNT; ++i) {
-    os << *rhombus.vertices_[i];
+    os << rhombus.vertices_[i];
     if (i < rhombus.VERTEX_COUNT - 1) {
       os << " ";
     }
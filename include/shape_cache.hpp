@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "point.hpp"
+
+namespace geometry {
+
+// Area, center and perimeter of a shape, each computed on first use and kept until the
+// owning shape changes a vertex. Const queries may fill it from several threads at once:
+// the values are atomics, racing fills store the same value, and each value's flag is set
+// after it with release ordering.
+template <Scalar T>
+class ShapeCache {
+ public:
+  ShapeCache();
+  ShapeCache(const ShapeCache& other) noexcept;
+  ShapeCache& operator=(const ShapeCache& other) noexcept;
+
+  void Invalidate();
+
+  // Each returns the cached value, calling compute() to fill it first if needed.
+  template <typename Compute>
+  double Area(Compute compute) const;
+  template <typename Compute>
+  double Perimeter(Compute compute) const;
+  template <typename Compute>
+  Point<T> Center(Compute compute) const;
+
+ private:
+  static constexpr uint8_t AREA_CACHED = 1 << 0;
+  static constexpr uint8_t CENTER_CACHED = 1 << 1;
+  static constexpr uint8_t PERIMETER_CACHED = 1 << 2;
+
+  void CopyFrom(const ShapeCache& other);
+
+  mutable std::atomic<double> area_;
+  mutable std::atomic<double> perimeter_;
+  mutable std::atomic<T> center_x_;
+  mutable std::atomic<T> center_y_;
+  mutable std::atomic<uint8_t> cached_;
+};
+
+}  // namespace geometry
+
+#include "shape_cache.ipp"
@@ -0,0 +1,73 @@
+#pragma once
+
+namespace geometry {
+
+template <Scalar T>
+ShapeCache<T>::ShapeCache()
+    : area_(0.0), perimeter_(0.0), center_x_(T{}), center_y_(T{}), cached_(0) {
+}
+
+template <Scalar T>
+ShapeCache<T>::ShapeCache(const ShapeCache& other) noexcept : ShapeCache() {
+  CopyFrom(other);
+}
+
+template <Scalar T>
+ShapeCache<T>& ShapeCache<T>::operator=(const ShapeCache& other) noexcept {
+  if (this != &other) {
+    CopyFrom(other);
+  }
+  return *this;
+}
+
+template <Scalar T>
+void ShapeCache<T>::Invalidate() {
+  cached_.store(0, std::memory_order_relaxed);
+}
+
+template <Scalar T>
+template <typename Compute>
+double ShapeCache<T>::Area(Compute compute) const {
+  if (!(cached_.load(std::memory_order_acquire) & AREA_CACHED)) {
+    area_.store(compute(), std::memory_order_relaxed);
+    cached_.fetch_or(AREA_CACHED, std::memory_order_release);
+  }
+  return area_.load(std::memory_order_relaxed);
+}
+
+template <Scalar T>
+template <typename Compute>
+double ShapeCache<T>::Perimeter(Compute compute) const {
+  if (!(cached_.load(std::memory_order_acquire) & PERIMETER_CACHED)) {
+    perimeter_.store(compute(), std::memory_order_relaxed);
+    cached_.fetch_or(PERIMETER_CACHED, std::memory_order_release);
+  }
+  return perimeter_.load(std::memory_order_relaxed);
+}
+
+template <Scalar T>
+template <typename Compute>
+Point<T> ShapeCache<T>::Center(Compute compute) const {
+  if (!(cached_.load(std::memory_order_acquire) & CENTER_CACHED)) {
+    Point<T> center = compute();
+    center_x_.store(center.x, std::memory_order_relaxed);
+    center_y_.store(center.y, std::memory_order_relaxed);
+    cached_.fetch_or(CENTER_CACHED, std::memory_order_release);
+    return center;
+  }
+  return Point<T>(center_x_.load(std::memory_order_relaxed),
+                  center_y_.load(std::memory_order_relaxed));
+}
+
+template <Scalar T>
+void ShapeCache<T>::CopyFrom(const ShapeCache& other) {
+  // Only values whose flag was seen are guaranteed complete; the rest are not used.
+  uint8_t cached = other.cached_.load(std::memory_order_acquire);
+  area_.store(other.area_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  perimeter_.store(other.perimeter_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  center_x_.store(other.center_x_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  center_y_.store(other.center_y_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  cached_.store(cached, std::memory_order_relaxed);
+}
+
+}  // namespace geometry
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+namespace geometry {
+
+// Stable identifiers; also written to figure files, so never renumber.
+enum class ShapeKind : uint8_t {
+  RECTANGLE = 1,
+  RHOMBUS = 2,
+  TRAPEZOID = 3,
+};
+
+}  // namespace geometry
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "point.hpp"
+#include "shape_kind.hpp"
+
+namespace geometry {
+
+// Bits of the mask returned by Validate; 0 means the vertices form the shape their type
+// claims. A NON_FINITE shape reports no other bit.
+struct ShapeDefect {
+  static constexpr uint8_t NON_FINITE = 1u << 0;        // a coordinate is NaN or infinite
+  static constexpr uint8_t DEGENERATE = 1u << 1;        // a side has (near) zero length
+  static constexpr uint8_t NOT_CONVEX = 1u << 2;        // self-intersecting, reflex or flat
+  static constexpr uint8_t NOT_PARALLEL = 1u << 3;      // opposite sides not parallel
+  static constexpr uint8_t NOT_RIGHT_ANGLED = 1u << 4;  // rectangle corner not 90 degrees
+  static constexpr uint8_t UNEQUAL_SIDES = 1u << 5;     // rhombus sides differ in length
+};
+
+// Selects the constructors that reject vertices which do not form the shape.
+struct StrictTag {};
+inline constexpr StrictTag STRICT{};
+
+class InvalidShapeError : public std::invalid_argument {
+ public:
+  InvalidShapeError(const std::string& shape, uint8_t defects);
+
+  uint8_t Defects() const;
+
+ private:
+  uint8_t defects_;
+};
+
+// Relative tolerance of the checks below for coordinates of type T: Point::EPSILON, or a
+// small multiple of T's machine epsilon when T cannot resolve that (float).
+template <Scalar T>
+inline constexpr double VALIDATION_TOLERANCE =
+    std::max(Point<double>::EPSILON,
+             64.0 * static_cast<double>(std::numeric_limits<T>::epsilon()));
+
+// Checks the quadrilateral (x[k], y[k]) against KIND: every shape must be convex with
+// non-degenerate sides; a rectangle also needs two pairs of parallel sides and right
+// angles, a rhombus two pairs of parallel sides of equal length, a trapezoid one pair of
+// parallel sides. `tolerance` is relative, on the sine/cosine of the angle between two
+// sides and on the ratio of squared side lengths, so the result does not depend on the
+// shape's scale. Evaluated in double without square roots; the batch kernels reproduce it
+// bit for bit.
+template <ShapeKind KIND>
+uint8_t ValidateQuadrilateral(const double* x, const double* y, double tolerance);
+
+// Uses VALIDATION_TOLERANCE<T>.
+template <ShapeKind KIND, Scalar T>
+uint8_t ValidateQuadrilateral(const Point<T>* vertices);
+
+std::string DescribeDefects(uint8_t defects);
+
+}  // namespace geometry
+
+#include "shape_validation.ipp"
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cmath>
+
+namespace geometry {
+
+inline InvalidShapeError::InvalidShapeError(const std::string& shape, uint8_t defects)
+    : std::invalid_argument("Invalid " + shape + ": " + DescribeDefects(defects)),
+      defects_(defects) {
+}
+
+inline uint8_t InvalidShapeError::Defects() const {
+  return defects_;
+}
+
+template <ShapeKind KIND>
+uint8_t ValidateQuadrilateral(const double* x, const double* y, double tolerance) {
+  double tolerance2 = tolerance * tolerance;
+
+  for (size_t k = 0; k < 4; ++k) {
+    if (!std::isfinite(x[k]) || !std::isfinite(y[k])) {
+      return ShapeDefect::NON_FINITE;
+    }
+  }
+
+  // Side k runs from vertex k to vertex k + 1.
+  double ex[4];
+  double ey[4];
+  double length2[4];
+  for (size_t k = 0; k < 4; ++k) {
+    size_t next = (k + 1) & 3;
+    ex[k] = x[next] - x[k];
+    ey[k] = y[next] - y[k];
+    length2[k] = ex[k] * ex[k] + ey[k] * ey[k];
+  }
+  double scale2 = (length2[0] + length2[1]) + (length2[2] + length2[3]);
+
+  uint8_t defects = 0;
+  bool left = false;
+  bool right = false;
+  bool flat = false;
+  for (size_t k = 0; k < 4; ++k) {
+    size_t next = (k + 1) & 3;
+    if (length2[k] <= tolerance2 * scale2) {
+      defects |= ShapeDefect::DEGENERATE;
+    }
+    // |a x b| <= eps |a||b| and |a . b| <= eps |a||b|, squared to avoid the roots.
+    double limit = tolerance2 * length2[k] * length2[next];
+    double cross = ex[k] * ey[next] - ey[k] * ex[next];
+    flat |= cross * cross <= limit;
+    left |= cross > 0.0;
+    right |= cross < 0.0;
+    if constexpr (KIND == ShapeKind::RECTANGLE) {
+      double dot = ex[k] * ex[next] + ey[k] * ey[next];
+      if (dot * dot > limit) {
+        defects |= ShapeDefect::NOT_RIGHT_ANGLED;
+      }
+    }
+    if constexpr (KIND == ShapeKind::RHOMBUS) {
+      if (std::abs(length2[next] - length2[k]) > tolerance * scale2) {
+        defects |= ShapeDefect::UNEQUAL_SIDES;
+      }
+    }
+  }
+  if (flat || (left && right)) {
+    defects |= ShapeDefect::NOT_CONVEX;
+  }
+
+  double cross02 = ex[0] * ey[2] - ey[0] * ex[2];
+  double cross13 = ex[1] * ey[3] - ey[1] * ex[3];
+  bool parallel02 = cross02 * cross02 <= tolerance2 * length2[0] * length2[2];
+  bool parallel13 = cross13 * cross13 <= tolerance2 * length2[1] * length2[3];
+  bool parallel = KIND == ShapeKind::TRAPEZOID ? parallel02 || parallel13
+                                               : parallel02 && parallel13;
+  if (!parallel) {
+    defects |= ShapeDefect::NOT_PARALLEL;
+  }
+  return defects;
+}
+
+template <ShapeKind KIND, Scalar T>
+uint8_t ValidateQuadrilateral(const Point<T>* vertices) {
+  double x[4];
+  double y[4];
+  for (size_t k = 0; k < 4; ++k) {
+    x[k] = static_cast<double>(vertices[k].x);
+    y[k] = static_cast<double>(vertices[k].y);
+  }
+  return ValidateQuadrilateral<KIND>(x, y, VALIDATION_TOLERANCE<T>);
+}
+
+inline std::string DescribeDefects(uint8_t defects) {
+  static constexpr struct {
+    uint8_t bit;
+    const char* text;
+  } NAMES[] = {
+      {ShapeDefect::NON_FINITE, "non-finite coordinate"},
+      {ShapeDefect::DEGENERATE, "degenerate side"},
+      {ShapeDefect::NOT_CONVEX, "not convex"},
+      {ShapeDefect::NOT_PARALLEL, "sides not parallel"},
+      {ShapeDefect::NOT_RIGHT_ANGLED, "not right-angled"},
+      {ShapeDefect::UNEQUAL_SIDES, "unequal sides"},
+  };
+  std::string text;
+  for (const auto& name : NAMES) {
+    if (defects & name.bit) {
+      if (!text.empty()) {
+        text += ", ";
+      }
+      text += name.text;
+    }
+  }
+  return text.empty() ? "valid" : text;
+}
+
+}  // namespace geometry
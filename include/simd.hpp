@@ -0,0 +1,31 @@
+#pragma once
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GEOMETRY_SIMD_X86 1
+#define GEOMETRY_TARGET_AVX2 __attribute__((target("avx2")))
+#define GEOMETRY_TARGET_SSE2 __attribute__((target("sse2")))
+#include <immintrin.h>
+#else
+#define GEOMETRY_SIMD_X86 0
+#endif
+
+namespace geometry {
+
+enum class SimdLevel {
+  SCALAR = 0,
+  SSE2 = 1,
+  AVX2 = 2,
+};
+
+// Best instruction set supported by the running CPU.
+SimdLevel DetectSimdLevel();
+
+// Instruction set used by the batch kernels. Defaults to DetectSimdLevel().
+SimdLevel GetSimdLevel();
+
+// Restricts the batch kernels to `level`; requests above the detected level are clamped.
+void SetSimdLevel(SimdLevel level);
+
+}  // namespace geometry
+
+#include "simd.ipp"
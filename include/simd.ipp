@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+
+namespace geometry {
+
+inline SimdLevel DetectSimdLevel() {
+#if GEOMETRY_SIMD_X86
+  static const SimdLevel detected = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+      return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+      return SimdLevel::SSE2;
+    }
+    return SimdLevel::SCALAR;
+  }();
+  return detected;
+#else
+  return SimdLevel::SCALAR;
+#endif
+}
+
+inline std::atomic<SimdLevel>& ActiveSimdLevel() {
+  static std::atomic<SimdLevel> level{DetectSimdLevel()};
+  return level;
+}
+
+inline SimdLevel GetSimdLevel() {
+  return ActiveSimdLevel().load(std::memory_order_relaxed);
+}
+
+inline void SetSimdLevel(SimdLevel level) {
+  SimdLevel detected = DetectSimdLevel();
+  if (static_cast<int>(level) > static_cast<int>(detected)) {
+    level = detected;
+  }
+  ActiveSimdLevel().store(level, std::memory_order_relaxed);
+}
+
+}  // namespace geometry
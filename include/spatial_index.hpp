@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "bounding_box.hpp"
+#include "figure_vector.hpp"
+#include "point.hpp"
+
+namespace geometry {
+
+// Uniform grid over the bounding boxes of a FigureArray. A figure is registered in every
+// cell its box overlaps; indices refer to positions in the array, so mirror every Insert,
+// PushBack and Erase on the array with the same call here. Figures outside the grid bounds
+// land in the border cells, and the grid is refitted once the figure count has doubled
+// since the last build.
+template <typename Figure>
+class GridIndex {
+ public:
+  static constexpr size_t DEFAULT_FIGURES_PER_CELL = 4;
+
+  GridIndex();
+  explicit GridIndex(const FigureArray<Figure>& figures,
+                     size_t figures_per_cell = DEFAULT_FIGURES_PER_CELL);
+
+  // Touch only the cells of `figure` plus one pass over the positions after `index`, so
+  // appending and erasing the last figure are O(cells covered).
+  void Insert(size_t index, const Figure& figure);
+  void PushBack(const Figure& figure);
+  void Erase(size_t index);
+
+  size_t Size() const;
+  bool Empty() const;
+  const BoundingBox& GetBox(size_t index) const;
+  const BoundingBox& GetBounds() const;
+  size_t GetCellCount() const;
+
+  // Ascending indices of the figures whose bounding box intersects `window`.
+  std::vector<size_t> QueryWindow(const BoundingBox& window) const;
+  // The `k` figures whose centers are closest to `point`, nearest first; ties go to the
+  // lower index.
+  std::vector<size_t> Nearest(const Point<double>& point, size_t k) const;
+
+ private:
+  void Rebuild();
+  void AddToCells(size_t id);
+  void RemoveFromCells(size_t id);
+  // Points positions_ back at ids_ from position `first` on.
+  void Renumber(size_t first);
+  size_t CellColumn(double x) const;
+  size_t CellRow(double y) const;
+  size_t CellOf(const Point<double>& point) const;
+
+  size_t figures_per_cell_;
+  size_t built_size_;
+  BoundingBox bounds_;
+  size_t columns_;
+  size_t rows_;
+  double cell_width_;
+  double cell_height_;
+  // Cells, boxes_ and centers_ use stable ids, so Insert and Erase touch only the cells of
+  // that figure; ids_ and positions_ map array positions to ids and back. Rebuild renumbers
+  // ids to match positions and drops the free ones.
+  std::vector<std::vector<size_t>> cells_;
+  std::vector<BoundingBox> boxes_;
+  std::vector<Point<double>> centers_;
+  std::vector<size_t> ids_;
+  std::vector<size_t> positions_;
+  std::vector<size_t> free_ids_;
+};
+
+}  // namespace geometry
+
+#include "spatial_index.ipp"
@@ -0,0 +1,345 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace geometry {
+
+template <typename Figure>
+GridIndex<Figure>::GridIndex()
+    : figures_per_cell_(DEFAULT_FIGURES_PER_CELL),
+      built_size_(0),
+      columns_(1),
+      rows_(1),
+      cell_width_(1.0),
+      cell_height_(1.0),
+      cells_(1) {
+}
+
+template <typename Figure>
+GridIndex<Figure>::GridIndex(const FigureArray<Figure>& figures, size_t figures_per_cell)
+    : GridIndex() {
+  figures_per_cell_ = std::max<size_t>(figures_per_cell, 1);
+  boxes_.reserve(figures.Size());
+  centers_.reserve(figures.Size());
+  ids_.reserve(figures.Size());
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    boxes_.push_back(BoundingBox::Of(figures[i]));
+    auto center = figures[i].GetCenter();
+    centers_.emplace_back(static_cast<double>(center.x), static_cast<double>(center.y));
+    ids_.push_back(i);
+  }
+  positions_ = ids_;
+  Rebuild();
+}
+
+template <typename Figure>
+void GridIndex<Figure>::Insert(size_t index, const Figure& figure) {
+  if (index > Size()) {
+    throw std::out_of_range("Index out of range");
+  }
+  auto center = figure.GetCenter();
+  Point<double> point(static_cast<double>(center.x), static_cast<double>(center.y));
+  size_t id;
+  if (free_ids_.empty()) {
+    id = boxes_.size();
+    boxes_.push_back(BoundingBox::Of(figure));
+    centers_.push_back(point);
+    positions_.push_back(0);
+  } else {
+    id = free_ids_.back();
+    free_ids_.pop_back();
+    boxes_[id] = BoundingBox::Of(figure);
+    centers_[id] = point;
+  }
+  ids_.insert(ids_.begin() + static_cast<std::ptrdiff_t>(index), id);
+  Renumber(index);
+  if (Size() > 2 * built_size_ && Size() > figures_per_cell_) {
+    Rebuild();
+  } else {
+    AddToCells(id);
+  }
+}
+
+template <typename Figure>
+void GridIndex<Figure>::PushBack(const Figure& figure) {
+  Insert(Size(), figure);
+}
+
+template <typename Figure>
+void GridIndex<Figure>::Erase(size_t index) {
+  if (index >= Size()) {
+    throw std::out_of_range("Index out of range");
+  }
+  size_t id = ids_[index];
+  RemoveFromCells(id);
+  ids_.erase(ids_.begin() + static_cast<std::ptrdiff_t>(index));
+  Renumber(index);
+  free_ids_.push_back(id);
+}
+
+template <typename Figure>
+size_t GridIndex<Figure>::Size() const {
+  return ids_.size();
+}
+
+template <typename Figure>
+bool GridIndex<Figure>::Empty() const {
+  return ids_.empty();
+}
+
+template <typename Figure>
+const BoundingBox& GridIndex<Figure>::GetBox(size_t index) const {
+  if (index >= Size()) {
+    throw std::out_of_range("Index out of range");
+  }
+  return boxes_[ids_[index]];
+}
+
+template <typename Figure>
+const BoundingBox& GridIndex<Figure>::GetBounds() const {
+  return bounds_;
+}
+
+template <typename Figure>
+size_t GridIndex<Figure>::GetCellCount() const {
+  return cells_.size();
+}
+
+template <typename Figure>
+std::vector<size_t> GridIndex<Figure>::QueryWindow(const BoundingBox& window) const {
+  std::vector<size_t> result;
+  if (window.IsEmpty() || Empty()) {
+    return result;
+  }
+  size_t first_column = CellColumn(window.min_x);
+  size_t last_column = CellColumn(window.max_x);
+  size_t first_row = CellRow(window.min_y);
+  size_t last_row = CellRow(window.max_y);
+  for (size_t row = first_row; row <= last_row; ++row) {
+    for (size_t column = first_column; column <= last_column; ++column) {
+      for (size_t id : cells_[row * columns_ + column]) {
+        const BoundingBox& box = boxes_[id];
+        if (!box.Intersects(window)) {
+          continue;
+        }
+        // A figure spanning several cells is reported only from the cell holding the
+        // lower-left corner of its overlap with the window.
+        if (CellColumn(std::max(box.min_x, window.min_x)) == column &&
+            CellRow(std::max(box.min_y, window.min_y)) == row) {
+          result.push_back(positions_[id]);
+        }
+      }
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+template <typename Figure>
+std::vector<size_t> GridIndex<Figure>::Nearest(const Point<double>& point, size_t k) const {
+  k = std::min(k, Size());
+  std::vector<std::pair<double, size_t>> best;
+  if (k == 0) {
+    return {};
+  }
+  best.reserve(k + 1);
+
+  auto visit = [&](size_t cell) {
+    for (size_t id : cells_[cell]) {
+      // Each figure is considered once, from the cell that holds its center.
+      if (CellOf(centers_[id]) != cell) {
+        continue;
+      }
+      double dx = centers_[id].x - point.x;
+      double dy = centers_[id].y - point.y;
+      std::pair<double, size_t> candidate(dx * dx + dy * dy, positions_[id]);
+      if (best.size() < k) {
+        best.push_back(candidate);
+        std::push_heap(best.begin(), best.end());
+      } else if (candidate < best.front()) {
+        std::pop_heap(best.begin(), best.end());
+        best.back() = candidate;
+        std::push_heap(best.begin(), best.end());
+      }
+    }
+  };
+
+  // Visit square rings of cells around the query cell until no unvisited cell can hold a
+  // center closer than the current k-th best.
+  size_t center_column = CellColumn(point.x);
+  size_t center_row = CellRow(point.y);
+  for (size_t ring = 0;; ++ring) {
+    bool left_open = center_column >= ring;
+    bool right_open = center_column + ring < columns_;
+    bool bottom_open = center_row >= ring;
+    bool top_open = center_row + ring < rows_;
+    size_t first_column = left_open ? center_column - ring : 0;
+    size_t last_column = right_open ? center_column + ring : columns_ - 1;
+    size_t first_row = bottom_open ? center_row - ring : 0;
+    size_t last_row = top_open ? center_row + ring : rows_ - 1;
+
+    for (size_t row = first_row; row <= last_row; ++row) {
+      bool edge_row = (bottom_open && row == first_row) || (top_open && row == last_row);
+      if (edge_row) {
+        for (size_t column = first_column; column <= last_column; ++column) {
+          visit(row * columns_ + column);
+        }
+        continue;
+      }
+      if (left_open) {
+        visit(row * columns_ + first_column);
+      }
+      if (right_open && ring > 0) {
+        visit(row * columns_ + last_column);
+      }
+    }
+
+    if (first_column == 0 && first_row == 0 && last_column == columns_ - 1 &&
+        last_row == rows_ - 1) {
+      break;
+    }
+    if (best.size() == k) {
+      // Any center outside the visited block is at least this far away. Sides that reach
+      // the grid border are closed: the border cells also hold everything beyond it.
+      double reach = std::numeric_limits<double>::infinity();
+      if (first_column > 0) {
+        reach = std::min(reach, point.x - (bounds_.min_x + first_column * cell_width_));
+      }
+      if (last_column + 1 < columns_) {
+        reach = std::min(reach, bounds_.min_x + (last_column + 1) * cell_width_ - point.x);
+      }
+      if (first_row > 0) {
+        reach = std::min(reach, point.y - (bounds_.min_y + first_row * cell_height_));
+      }
+      if (last_row + 1 < rows_) {
+        reach = std::min(reach, bounds_.min_y + (last_row + 1) * cell_height_ - point.y);
+      }
+      if (best.front().first < reach * reach) {
+        break;
+      }
+    }
+  }
+
+  std::sort_heap(best.begin(), best.end());
+  std::vector<size_t> result(best.size());
+  for (size_t i = 0; i < best.size(); ++i) {
+    result[i] = best[i].second;
+  }
+  return result;
+}
+
+template <typename Figure>
+void GridIndex<Figure>::Rebuild() {
+  if (!free_ids_.empty() || !std::is_sorted(ids_.begin(), ids_.end())) {
+    std::vector<BoundingBox> boxes(Size());
+    std::vector<Point<double>> centers(Size());
+    for (size_t i = 0; i < Size(); ++i) {
+      boxes[i] = boxes_[ids_[i]];
+      centers[i] = centers_[ids_[i]];
+      ids_[i] = i;
+    }
+    boxes_ = std::move(boxes);
+    centers_ = std::move(centers);
+    positions_ = ids_;
+    free_ids_.clear();
+  }
+
+  bounds_ = BoundingBox();
+  for (const BoundingBox& box : boxes_) {
+    bounds_.Expand(box);
+  }
+  if (bounds_.IsEmpty()) {
+    bounds_ = BoundingBox(0.0, 0.0, 0.0, 0.0);
+  }
+
+  // Aim for figures_per_cell_ figures per cell with roughly square cells.
+  size_t target = std::max<size_t>(Size() / figures_per_cell_, 1);
+  double width = bounds_.Width();
+  double height = bounds_.Height();
+  if (width > 0.0 && height > 0.0) {
+    double columns = std::round(std::sqrt(static_cast<double>(target) * width / height));
+    columns_ = std::clamp<size_t>(static_cast<size_t>(columns), 1, target);
+    rows_ = std::max<size_t>((target + columns_ - 1) / columns_, 1);
+  } else if (width > 0.0) {
+    columns_ = target;
+    rows_ = 1;
+  } else if (height > 0.0) {
+    columns_ = 1;
+    rows_ = target;
+  } else {
+    columns_ = 1;
+    rows_ = 1;
+  }
+  cell_width_ = width > 0.0 ? width / static_cast<double>(columns_) : 1.0;
+  cell_height_ = height > 0.0 ? height / static_cast<double>(rows_) : 1.0;
+
+  cells_.assign(columns_ * rows_, {});
+  for (size_t i = 0; i < Size(); ++i) {
+    AddToCells(i);
+  }
+  built_size_ = Size();
+}
+
+template <typename Figure>
+void GridIndex<Figure>::AddToCells(size_t id) {
+  const BoundingBox& box = boxes_[id];
+  if (box.IsEmpty()) {
+    return;
+  }
+  for (size_t row = CellRow(box.min_y); row <= CellRow(box.max_y); ++row) {
+    for (size_t column = CellColumn(box.min_x); column <= CellColumn(box.max_x); ++column) {
+      cells_[row * columns_ + column].push_back(id);
+    }
+  }
+}
+
+template <typename Figure>
+void GridIndex<Figure>::RemoveFromCells(size_t id) {
+  const BoundingBox& box = boxes_[id];
+  if (box.IsEmpty()) {
+    return;
+  }
+  for (size_t row = CellRow(box.min_y); row <= CellRow(box.max_y); ++row) {
+    for (size_t column = CellColumn(box.min_x); column <= CellColumn(box.max_x); ++column) {
+      std::vector<size_t>& cell = cells_[row * columns_ + column];
+      cell.erase(std::find(cell.begin(), cell.end(), id));
+    }
+  }
+}
+
+template <typename Figure>
+void GridIndex<Figure>::Renumber(size_t first) {
+  for (size_t i = first; i < Size(); ++i) {
+    positions_[ids_[i]] = i;
+  }
+}
+
+template <typename Figure>
+size_t GridIndex<Figure>::CellColumn(double x) const {
+  double column = (x - bounds_.min_x) / cell_width_;
+  // Written so that NaN lands in the first cell.
+  if (!(column >= 1.0)) {
+    return 0;
+  }
+  return column >= static_cast<double>(columns_) ? columns_ - 1 : static_cast<size_t>(column);
+}
+
+template <typename Figure>
+size_t GridIndex<Figure>::CellRow(double y) const {
+  double row = (y - bounds_.min_y) / cell_height_;
+  if (!(row >= 1.0)) {
+    return 0;
+  }
+  return row >= static_cast<double>(rows_) ? rows_ - 1 : static_cast<size_t>(row);
+}
+
+template <typename Figure>
+size_t GridIndex<Figure>::CellOf(const Point<double>& point) const {
+  return CellRow(point.y) * columns_ + CellColumn(point.x);
+}
+
+}  // namespace geometry
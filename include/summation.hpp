@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace geometry {
+
+// Compensated (Kahan-Babuska) summation: the result depends only on the order of Add calls.
+class KahanAccumulator {
+ public:
+  KahanAccumulator();
+
+  void Add(double value);
+  double Sum() const;
+
+ private:
+  double sum_;
+  double compensation_;
+};
+
+// Exact summation with removal: finite values are added into a fixed-point integer that
+// spans the whole double range, so Subtract(v) undoes Add(v) exactly and Sum() is the
+// correctly rounded total whatever the order of the calls. Infinities and NaNs are counted.
+class ExactAccumulator {
+ public:
+  ExactAccumulator();
+
+  void Add(double value);
+  void Subtract(double value);
+  void Add(const ExactAccumulator& other);
+  void Subtract(const ExactAccumulator& other);
+  double Sum() const;
+
+ private:
+  static constexpr int DIGIT_BITS = 32;
+  static constexpr int64_t DIGIT_MASK = (int64_t{1} << DIGIT_BITS) - 1;
+  // Bit 0 of digit 0 weighs 2^-1074, the least subnormal; the digits above 2^1024 absorb
+  // carries of totals beyond the double range.
+  static constexpr int LEAST_EXPONENT = -1074;
+  static constexpr size_t DIGIT_COUNT = 68;
+  // Each update moves a digit by less than 2^32, so carries are propagated after this many
+  // updates, long before an int64_t digit could overflow.
+  static constexpr uint32_t NORMALIZE_INTERVAL = uint32_t{1} << 30;
+
+  void Accumulate(double value, int64_t sign);
+  void Accumulate(const ExactAccumulator& other, int64_t sign);
+  static void Normalize(std::array<int64_t, DIGIT_COUNT>& digits);
+
+  std::array<int64_t, DIGIT_COUNT> digits_;
+  uint32_t updates_;
+  int64_t positive_infinities_;
+  int64_t negative_infinities_;
+  int64_t nans_;
+};
+
+}  // namespace geometry
+
+#include "summation.ipp"
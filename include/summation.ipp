@@ -0,0 +1,169 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace geometry {
+
+inline KahanAccumulator::KahanAccumulator() : sum_(0.0), compensation_(0.0) {
+}
+
+inline void KahanAccumulator::Add(double value) {
+  double t = sum_ + value;
+  if (std::abs(sum_) >= std::abs(value)) {
+    compensation_ += (sum_ - t) + value;
+  } else {
+    compensation_ += (value - t) + sum_;
+  }
+  sum_ = t;
+}
+
+inline double KahanAccumulator::Sum() const {
+  return sum_ + compensation_;
+}
+
+inline ExactAccumulator::ExactAccumulator()
+    : digits_{}, updates_(0), positive_infinities_(0), negative_infinities_(0), nans_(0) {
+}
+
+inline void ExactAccumulator::Add(double value) {
+  Accumulate(value, 1);
+}
+
+inline void ExactAccumulator::Subtract(double value) {
+  Accumulate(value, -1);
+}
+
+inline void ExactAccumulator::Add(const ExactAccumulator& other) {
+  Accumulate(other, 1);
+}
+
+inline void ExactAccumulator::Subtract(const ExactAccumulator& other) {
+  Accumulate(other, -1);
+}
+
+inline double ExactAccumulator::Sum() const {
+  if (nans_ > 0 || (positive_infinities_ > 0 && negative_infinities_ > 0)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  if (positive_infinities_ > 0 || negative_infinities_ > 0) {
+    double infinity = std::numeric_limits<double>::infinity();
+    return positive_infinities_ > 0 ? infinity : -infinity;
+  }
+
+  // Propagate the carries so every digit but the top one lies in [0, 2^32); a negative top
+  // digit means a negative total, whose magnitude is normalized the same way.
+  std::array<int64_t, DIGIT_COUNT> digits = digits_;
+  Normalize(digits);
+  bool negative = digits.back() < 0;
+  if (negative) {
+    for (int64_t& digit : digits) {
+      digit = -digit;
+    }
+    Normalize(digits);
+  }
+  ptrdiff_t top = static_cast<ptrdiff_t>(DIGIT_COUNT) - 1;
+  while (top >= 0 && digits[top] == 0) {
+    --top;
+  }
+  if (top < 0) {
+    return 0.0;
+  }
+  if (DIGIT_BITS * top + LEAST_EXPONENT >= std::numeric_limits<double>::max_exponent) {
+    return negative ? -std::numeric_limits<double>::infinity()
+                    : std::numeric_limits<double>::infinity();
+  }
+
+  // The 64 leading bits, with every lower bit folded into `sticky`.
+  auto digit = [&](ptrdiff_t i) { return i >= 0 ? static_cast<uint64_t>(digits[i]) : 0; };
+  uint64_t window = (digit(top) << DIGIT_BITS) | digit(top - 1);
+  int leading = std::countl_zero(window);
+  uint64_t next = digit(top - 2);
+  window = (window << leading) | (next >> (DIGIT_BITS - leading));
+  bool sticky = (next & ((uint64_t{1} << (DIGIT_BITS - leading)) - 1)) != 0;
+  for (ptrdiff_t i = top - 3; i >= 0 && !sticky; --i) {
+    sticky = digits[i] != 0;
+  }
+
+  // Round to the 53-bit significand, ties to even. Totals below 2^-1022 have fewer than 53
+  // significant bits, so ldexp is exact for them too.
+  constexpr int DROPPED_BITS = 64 - std::numeric_limits<double>::digits;
+  constexpr uint64_t HALF = uint64_t{1} << (DROPPED_BITS - 1);
+  uint64_t mantissa = window >> DROPPED_BITS;
+  uint64_t rest = window & ((uint64_t{1} << DROPPED_BITS) - 1);
+  if (rest > HALF || (rest == HALF && (sticky || (mantissa & 1) != 0))) {
+    ++mantissa;
+  }
+  int exponent = DIGIT_BITS * static_cast<int>(top - 1) - leading + DROPPED_BITS + LEAST_EXPONENT;
+  double magnitude = std::ldexp(static_cast<double>(mantissa), exponent);
+  return negative ? -magnitude : magnitude;
+}
+
+inline void ExactAccumulator::Accumulate(double value, int64_t sign) {
+  if (std::isnan(value)) {
+    nans_ += sign;
+    return;
+  }
+  if (std::isinf(value)) {
+    (value > 0.0 ? positive_infinities_ : negative_infinities_) += sign;
+    return;
+  }
+  if (value == 0.0) {
+    return;
+  }
+  if (value < 0.0) {
+    value = -value;
+    sign = -sign;
+  }
+
+  // value = mantissa * 2^(shift + LEAST_EXPONENT) with an integer mantissa.
+  int exponent = 0;
+  double fraction = std::frexp(value, &exponent);
+  constexpr int MANTISSA_BITS = std::numeric_limits<double>::digits;
+  auto mantissa = static_cast<uint64_t>(std::ldexp(fraction, MANTISSA_BITS));
+  int shift = exponent - MANTISSA_BITS - LEAST_EXPONENT;
+  if (shift < 0) {
+    // Subnormal: the bits shifted out are zero.
+    mantissa >>= -shift;
+    shift = 0;
+  }
+  size_t index = static_cast<size_t>(shift / DIGIT_BITS);
+  int offset = shift % DIGIT_BITS;
+  uint64_t low = mantissa << offset;
+  uint64_t high = offset == 0 ? 0 : mantissa >> (64 - offset);
+  digits_[index] += sign * static_cast<int64_t>(low & DIGIT_MASK);
+  digits_[index + 1] += sign * static_cast<int64_t>(low >> DIGIT_BITS);
+  digits_[index + 2] += sign * static_cast<int64_t>(high);
+  if (++updates_ >= NORMALIZE_INTERVAL) {
+    Normalize(digits_);
+    updates_ = 0;
+  }
+}
+
+inline void ExactAccumulator::Accumulate(const ExactAccumulator& other, int64_t sign) {
+  // Our digits drop below 2^32, so the sum stays within the bound of other's update count.
+  Normalize(digits_);
+  for (size_t i = 0; i < DIGIT_COUNT; ++i) {
+    digits_[i] += sign * other.digits_[i];
+  }
+  updates_ = other.updates_ + 1;
+  if (updates_ >= NORMALIZE_INTERVAL) {
+    Normalize(digits_);
+    updates_ = 0;
+  }
+  positive_infinities_ += sign * other.positive_infinities_;
+  negative_infinities_ += sign * other.negative_infinities_;
+  nans_ += sign * other.nans_;
+}
+
+inline void ExactAccumulator::Normalize(std::array<int64_t, DIGIT_COUNT>& digits) {
+  for (size_t i = 0; i + 1 < DIGIT_COUNT; ++i) {
+    // Arithmetic shift: the carry of a negative digit is negative.
+    int64_t carry = digits[i] >> DIGIT_BITS;
+    digits[i] &= DIGIT_MASK;
+    digits[i + 1] += carry;
+  }
+}
+
+}  // namespace geometry
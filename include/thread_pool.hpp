@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace geometry {
+
+// Fixed set of worker threads that execute chunked loops. The calling thread takes part
+// in every ParallelFor, so a pool of N threads starts N - 1 workers.
+class ThreadPool {
+ public:
+  explicit ThreadPool(size_t thread_count = std::thread::hardware_concurrency());
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool();
+
+  size_t ThreadCount() const;
+
+  // Calls body(chunk) for every chunk in [0, chunk_count) and blocks until all have run.
+  // The first exception thrown by body is rethrown on the calling thread.
+  void ParallelFor(size_t chunk_count, const std::function<void(size_t)>& body);
+
+ private:
+  void WorkerLoop();
+  void RunChunks();
+
+  std::vector<std::thread> workers_;
+  std::mutex run_mutex_;
+  std::mutex error_mutex_;
+
+  // Workers block on generation_ (C++20 atomic wait) and the caller blocks on
+  // pending_workers_, so a job hand-off costs one notify in each direction.
+  const std::function<void(size_t)>* job_;
+  size_t chunk_count_;
+  std::atomic<size_t> next_chunk_;
+  std::atomic<size_t> pending_workers_;
+  std::atomic<uint64_t> generation_;
+  std::atomic<bool> stop_;
+  std::exception_ptr error_;
+};
+
+}  // namespace geometry
+
+#include "thread_pool.ipp"
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <utility>
+
+namespace geometry {
+
+inline ThreadPool::ThreadPool(size_t thread_count)
+    : job_(nullptr),
+      chunk_count_(0),
+      next_chunk_(0),
+      pending_workers_(0),
+      generation_(0),
+      stop_(false) {
+  if (thread_count == 0) {
+    thread_count = 1;
+  }
+  workers_.reserve(thread_count - 1);
+  for (size_t i = 1; i < thread_count; ++i) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+  }
+}
+
+inline ThreadPool::~ThreadPool() {
+  stop_.store(true, std::memory_order_release);
+  generation_.fetch_add(1, std::memory_order_release);
+  generation_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+inline size_t ThreadPool::ThreadCount() const {
+  return workers_.size() + 1;
+}
+
+inline void ThreadPool::ParallelFor(size_t chunk_count,
+                                    const std::function<void(size_t)>& body) {
+  if (chunk_count == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+  if (workers_.empty() || chunk_count == 1) {
+    for (size_t i = 0; i < chunk_count; ++i) {
+      body(i);
+    }
+    return;
+  }
+
+  job_ = &body;
+  chunk_count_ = chunk_count;
+  error_ = nullptr;
+  next_chunk_.store(0, std::memory_order_relaxed);
+  pending_workers_.store(workers_.size(), std::memory_order_relaxed);
+  generation_.fetch_add(1, std::memory_order_release);
+  generation_.notify_all();
+
+  RunChunks();
+
+  size_t pending = pending_workers_.load(std::memory_order_acquire);
+  while (pending != 0) {
+    pending_workers_.wait(pending, std::memory_order_acquire);
+    pending = pending_workers_.load(std::memory_order_acquire);
+  }
+  job_ = nullptr;
+  if (error_) {
+    std::rethrow_exception(std::exchange(error_, nullptr));
+  }
+}
+
+inline void ThreadPool::WorkerLoop() {
+  uint64_t seen_generation = 0;
+  while (true) {
+    generation_.wait(seen_generation, std::memory_order_acquire);
+    if (stop_.load(std::memory_order_acquire)) {
+      return;
+    }
+    seen_generation = generation_.load(std::memory_order_acquire);
+
+    RunChunks();
+
+    if (pending_workers_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      pending_workers_.notify_all();
+    }
+  }
+}
+
+inline void ThreadPool::RunChunks() {
+  while (true) {
+    size_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+    if (chunk >= chunk_count_) {
+      return;
+    }
+    try {
+      (*job_)(chunk);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+  }
+}
+
+}  // namespace geometry
@@ -1,38 +1,27 @@
 #pragma once
 
+#include <stdexcept>
+
 namespace geometry {
 
 template <Scalar T>
-Trapezoid<T>::Trapezoid() {
-  for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-    vertices_[i] = std::make_unique<Point<T>>();
-  }
+Trapezoid<T>::Trapezoid() : vertices_{}, cache_() {
 }
 
 template <Scalar T>
 Trapezoid<T>::Trapezoid(const Point<T>& p1, const Point<T>& p2, const Point<T>& p3,
-                        const Point<T>& p4) {
-  vertices_[0] = std::make_unique<Point<T>>(p1);
-  vertices_[1] = std::make_unique<Point<T>>(p2);
-  vertices_[2] = std::make_unique<Point<T>>(p3);
-  vertices_[3] = std::make_unique<Point<T>>(p4);
-}
-
-template <Scalar T>
-Trapezoid<T>::Trapezoid(const Trapezoid& other) {
-  for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-    vertices_[i] = std::make_unique<Point<T>>(*other.vertices_[i]);
-  }
+                        const Point<T>& p4)
+    : vertices_{p1, p2, p3, p4}, cache_() {
 }
 
 template <Scalar T>
-Trapezoid<T>& Trapezoid<T>::operator=(const Trapezoid& other) {
-  if (this != &other) {
-    for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-      vertices_[i] = std::make_unique<Point<T>>(*other.vertices_[i]);
-    }
+Trapezoid<T>::Trapezoid(StrictTag, const Point<T>& p1, const Point<T>& p2, const Point<T>& p3,
+                        const Point<T>& p4)
+    : Trapezoid(p1, p2, p3, p4) {
+  uint8_t defects = Validate();
+  if (defects != 0) {
+    throw InvalidShapeError("trapezoid", defects);
   }
-  return *this;
 }
 
 template <Scalar T>
@@ -41,7 +30,7 @@ bool Trapezoid<T>::operator==(const Trapezoid& other) const {
     return false;
   }
   for (size_t i = 0; i < VERTEX_COUNT; ++i) {
-    if (*vertices_[i] != *other.vertices_[i]) {
+    if (vertices_[i] != other.vertices_[i]) {
       return false;
     }
   }
@@ -53,39 +42,112 @@ size_t Trapezoid<T>::GetVertexCount() const {
   return VERTEX_COUNT;
 }
 
+template <Scalar T>
+const Point<T>& Trapezoid<T>::GetVertex(size_t index) const {
+  if (index >= VERTEX_COUNT) {
+    throw std::out_of_range("Vertex index out of range");
+  }
+  return vertices_[index];
+}
+
+template <Scalar T>
+void Trapezoid<T>::SetVertex(size_t index, const Point<T>& vertex) {
+  if (index >= VERTEX_COUNT) {
+    throw std::out_of_range("Vertex index out of range");
+  }
+  vertices_[index] = vertex;
+  cache_.Invalidate();
+}
+
+template <Scalar T>
+uint8_t Trapezoid<T>::Validate() const {
+  return ValidateQuadrilateral<ShapeKind::TRAPEZOID>(vertices_.data());
+}
+
+template <Scalar T>
+void Trapezoid<T>::Transform(const AffineTransform& transform) {
+  Transform(PointTransformer<T>(transform));
+}
+
+template <Scalar T>
+void Trapezoid<T>::Transform(const PointTransformer<T>& transformer) {
+  transformer(vertices_.data(), VERTEX_COUNT);
+  cache_.Invalidate();
+}
+
+template <Scalar T>
+void Trapezoid<T>::Translate(double dx, double dy) {
+  Transform(AffineTransform::Translation(dx, dy));
+}
+
+template <Scalar T>
+void Trapezoid<T>::Rotate(double radians) {
+  Transform(AffineTransform::Rotation(radians));
+}
+
+template <Scalar T>
+void Trapezoid<T>::Scale(double sx, double sy) {
+  Transform(AffineTransform::Scaling(sx, sy));
+}
+
 template <Scalar T>
 Point<T> Trapezoid<T>::GetCenter() const {
-  return Figure<T>::CalculateCenter(vertices_, VERTEX_COUNT);
+  instrumentation::Record<Trapezoid>(Counter::CENTER_CALLS);
+  return cache_.Center(
+      [this] { return Figure<T>::CalculateCenter(vertices_.data(), VERTEX_COUNT); });
+}
+
+template <Scalar T>
+double Trapezoid<T>::GetPerimeter() const {
+  return cache_.Perimeter(
+      [this] { return Figure<T>::CalculatePerimeter(vertices_.data(), VERTEX_COUNT); });
 }
 
 template <Scalar T>
 Trapezoid<T>::operator double() const {
-  T x1 = vertices_[0]->x;
-  T x2 = vertices_[1]->x;
-  T x3 = vertices_[2]->x;
-  T x4 = vertices_[3]->x;
-  T y1 = vertices_[0]->y;
-  T y2 = vertices_[1]->y;
-  T y3 = vertices_[2]->y;
-  T y4 = vertices_[3]->y;
+  instrumentation::Record<Trapezoid>(Counter::AREA_CALLS);
+  return cache_.Area([this] { return CalculateArea(); });
+}
 
-  double area = 0.5 * std::abs((x1 * y2 + x2 * y3 + x3 * y4 + x4 * y1) -
-                               (y1 * x2 + y2 * x3 + y3 * x4 + y4 * x1));
-  return area;
+template <Scalar T>
+Int128 Trapezoid<T>::TwiceArea() const requires std::integral<T> {
+  Int128 twice = TwiceSignedArea(vertices_.data());
+  return twice < 0 ? -twice : twice;
+}
+
+template <Scalar T>
+double Trapezoid<T>::CalculateArea() const {
+  if constexpr (std::integral<T>) {
+    return 0.5 * ToDouble(TwiceArea());
+  } else {
+    T x1 = vertices_[0].x;
+    T x2 = vertices_[1].x;
+    T x3 = vertices_[2].x;
+    T x4 = vertices_[3].x;
+    T y1 = vertices_[0].y;
+    T y2 = vertices_[1].y;
+    T y3 = vertices_[2].y;
+    T y4 = vertices_[3].y;
+
+    double area = 0.5 * std::abs((x1 * y2 + x2 * y3 + x3 * y4 + x4 * y1) -
+                                 (y1 * x2 + y2 * x3 + y3 * x4 + y4 * x1));
+    return area;
+  }
 }
 
 template <Scalar T>
 std::istream& operator>>(std::istream& is, Trapezoid<T>& trapezoid) {
   for (size_t i = 0; i < trapezoid.VERTEX_COUNT; ++i) {
-    is >> *trapezoid.vertices_[i];
+    is >> trapezoid.vertices_[i];
   }
+  trapezoid.cache_.Invalidate();
   return is;
 }
 
 template <Scalar T>
 std::ostream& operator<<(std::ostream& os, const Trapezoid<T>& trapezoid) {
   for (size_t i = 0; i < trapezoid.VERTEX_COUNT; ++i) {
-    os << *trapezoid.vertices_[i];
+    os << trapezoid.vertices_[i];
     if (i < trapezoid.VERTEX_COUNT - 1) {
       os << " ";
     }
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "collision.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+namespace {
+
+Rectangle<double> Square(double x, double y, double side) {
+  return Rectangle<double>(Point<double>(x, y), Point<double>(x + side, y),
+                           Point<double>(x + side, y + side), Point<double>(x, y + side));
+}
+
+Rectangle<double> RandomRectangle(std::mt19937& rng) {
+  std::uniform_real_distribution<double> position(0.0, 100.0);
+  std::uniform_real_distribution<double> size(0.5, 4.0);
+  std::uniform_real_distribution<double> angle(0.0, std::numbers::pi);
+  Rectangle<double> rectangle = Square(0.0, 0.0, 1.0);
+  double x = position(rng);
+  double y = position(rng);
+  rectangle.Transform(AffineTransform::Scaling(size(rng), size(rng))
+                          .Then(AffineTransform::Rotation(angle(rng)))
+                          .Then(AffineTransform::Translation(x, y)));
+  return rectangle;
+}
+
+std::vector<IndexPair> BruteForceBoxes(const std::vector<BoundingBox>& boxes) {
+  std::vector<IndexPair> pairs;
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    for (size_t j = i + 1; j < boxes.size(); ++j) {
+      if (!boxes[i].IsEmpty() && !boxes[j].IsEmpty() && boxes[i].Intersects(boxes[j])) {
+        pairs.emplace_back(i, j);
+      }
+    }
+  }
+  return pairs;
+}
+
+}  // namespace
+
+TEST(CollisionTest, SeparatingAxis) {
+  Rectangle<double> unit = Square(0.0, 0.0, 1.0);
+  EXPECT_TRUE(Overlaps(unit, Square(0.5, 0.5, 1.0)));
+  EXPECT_TRUE(Overlaps(unit, Square(1.0, 0.0, 1.0)));
+  EXPECT_TRUE(Overlaps(unit, Square(0.25, 0.25, 0.5)));
+  EXPECT_TRUE(Overlaps(Square(0.25, 0.25, 0.5), unit));
+  EXPECT_FALSE(Overlaps(unit, Square(1.5, 0.0, 1.0)));
+
+  // Bounding boxes overlap, but the diagonal edge separates the shapes.
+  Rhombus<double> diamond(Point<double>(2.0, 3.0), Point<double>(3.0, 2.0),
+                          Point<double>(2.0, 1.0), Point<double>(1.0, 2.0));
+  EXPECT_TRUE(BoundingBox::Of(unit).Intersects(BoundingBox(1.0, 1.0, 3.0, 3.0)));
+  EXPECT_FALSE(Overlaps(Square(0.0, 0.0, 1.4), diamond));
+  EXPECT_TRUE(Overlaps(Square(0.0, 0.0, 1.6), diamond));
+
+  Trapezoid<int> trapezoid(Point<int>(0, 0), Point<int>(6, 0), Point<int>(4, 2), Point<int>(2, 2));
+  EXPECT_TRUE(Overlaps(trapezoid, Rectangle<int>(Point<int>(4, 2), Point<int>(5, 2),
+                                                 Point<int>(5, 3), Point<int>(4, 3))));
+  EXPECT_FALSE(Overlaps(trapezoid, Rectangle<int>(Point<int>(5, 2), Point<int>(6, 2),
+                                                  Point<int>(6, 3), Point<int>(5, 3))));
+}
+
+TEST(CollisionTest, BroadPhaseMatchesBruteForce) {
+  std::mt19937 rng(23);
+  FigureArray<Rectangle<double>> figures;
+  for (int i = 0; i < 3000; ++i) {
+    figures.PushBack(RandomRectangle(rng));
+  }
+  std::vector<BoundingBox> boxes = ComputeBoundingBoxes(figures);
+  boxes[10] = BoundingBox();
+  boxes[11].min_x = std::numeric_limits<double>::quiet_NaN();
+  boxes[12] = BoundingBox(40.0, 0.0, 41.0, 100.0);
+
+  std::vector<IndexPair> expected = BruteForceBoxes(boxes);
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(BroadPhasePairs(boxes), expected);
+
+  ThreadPool pool(3);
+  EXPECT_EQ(ComputeBoundingBoxes(figures, pool), ComputeBoundingBoxes(figures));
+  EXPECT_EQ(BroadPhasePairs(boxes, pool), expected);
+}
+
+TEST(CollisionTest, FindOverlapsMatchesBruteForce) {
+  std::mt19937 rng(29);
+  FigureArray<Rectangle<double>> figures;
+  for (int i = 0; i < 2000; ++i) {
+    figures.PushBack(RandomRectangle(rng));
+  }
+  std::vector<IndexPair> expected;
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    for (size_t j = i + 1; j < figures.Size(); ++j) {
+      if (Overlaps(figures[i], figures[j])) {
+        expected.emplace_back(i, j);
+      }
+    }
+  }
+  std::vector<IndexPair> candidates = BroadPhasePairs(ComputeBoundingBoxes(figures));
+  EXPECT_LT(expected.size(), candidates.size());
+
+  EXPECT_EQ(FindOverlaps(figures), expected);
+  ThreadPool pool(4);
+  EXPECT_EQ(FindOverlaps(figures, pool), expected);
+}
+
+TEST(CollisionTest, InfiniteBoxes) {
+  double inf = std::numeric_limits<double>::infinity();
+  std::vector<BoundingBox> boxes = {BoundingBox(0.0, 0.0, 1.0, 1.0),
+                                    BoundingBox(0.5, -inf, 0.6, inf),
+                                    BoundingBox(2.0, 2.0, 3.0, 3.0)};
+  EXPECT_EQ(BroadPhasePairs(boxes), BruteForceBoxes(boxes));
+}
+
+TEST(CollisionTest, EmptyArray) {
+  FigureArray<Trapezoid<int>> figures;
+  ThreadPool pool(2);
+  EXPECT_TRUE(FindOverlaps(figures).empty());
+  EXPECT_TRUE(FindOverlaps(figures, pool).empty());
+}
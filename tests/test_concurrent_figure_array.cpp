@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include "concurrent_figure_array.hpp"
+#include "rectangle.hpp"
+
+using namespace geometry;
+
+namespace {
+
+Rectangle<int> Tagged(int producer, int i) {
+  return Rectangle<int>(Point<int>(producer, i), Point<int>(producer + 1, i),
+                        Point<int>(producer + 1, i + 1), Point<int>(producer, i + 1));
+}
+
+}  // namespace
+
+TEST(ConcurrentFigureArrayTest, MultiProducerMerge) {
+  constexpr int PRODUCERS = 4;
+  constexpr int PER_PRODUCER = 20000;
+  ConcurrentFigureArray<Rectangle<int>> array;
+  std::vector<ConcurrentFigureArray<Rectangle<int>>::Producer> producers;
+  for (int p = 0; p < PRODUCERS; ++p) {
+    producers.push_back(array.CreateProducer());
+  }
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < PRODUCERS; ++p) {
+    threads.emplace_back([&, p] {
+      for (int i = 0; i < PER_PRODUCER; ++i) {
+        producers[p].EmplaceBack(Point<int>(p, i), Point<int>(p + 1, i), Point<int>(p + 1, i + 1),
+                                 Point<int>(p, i + 1));
+      }
+    });
+  }
+  // Size may be read while producers run.
+  EXPECT_LE(array.Size(), static_cast<size_t>(PRODUCERS * PER_PRODUCER));
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(array.Size(), static_cast<size_t>(PRODUCERS * PER_PRODUCER));
+  EXPECT_DOUBLE_EQ(array.GetTotalArea(), PRODUCERS * PER_PRODUCER);
+
+  FigureArray<Rectangle<int>> merged = array.Merge();
+  ASSERT_EQ(merged.Size(), static_cast<size_t>(PRODUCERS * PER_PRODUCER));
+  for (int p = 0; p < PRODUCERS; ++p) {
+    for (int i = 0; i < PER_PRODUCER; i += 997) {
+      EXPECT_EQ(merged[static_cast<size_t>(p * PER_PRODUCER + i)], Tagged(p, i));
+    }
+  }
+  EXPECT_TRUE(array.Empty());
+  EXPECT_EQ(producers[0].Size(), 0);
+
+  // Producers remain usable after a merge.
+  producers[2].PushBack(Tagged(2, 0));
+  EXPECT_EQ(array.Merge().Size(), 1);
+}
+
+TEST(ConcurrentFigureArrayTest, ReferencesStayValidWhileGrowing) {
+  ConcurrentFigureArray<Rectangle<int>> array;
+  auto producer = array.CreateProducer();
+  const Rectangle<int>& first = producer.EmplaceBack(Tagged(0, 0));
+  const Rectangle<int>* address = &first;
+  for (int i = 1; i < 100000; ++i) {
+    producer.PushBack(Tagged(0, i));
+  }
+  EXPECT_EQ(&first, address);
+  EXPECT_EQ(first, Tagged(0, 0));
+}
+
+TEST(ConcurrentFigureArrayTest, FreezeGivesIndexedView) {
+  ConcurrentFigureArray<Rectangle<int>> array;
+  auto a = array.CreateProducer();
+  auto b = array.CreateProducer();
+  auto c = array.CreateProducer();
+  for (int i = 0; i < 600; ++i) {
+    b.PushBack(Tagged(1, i));
+  }
+  for (int i = 0; i < 3; ++i) {
+    a.PushBack(Tagged(0, i));
+  }
+  EXPECT_THROW(array[0], std::logic_error);
+
+  array.Freeze();
+  EXPECT_TRUE(array.IsFrozen());
+  EXPECT_THROW(a.PushBack(Tagged(0, 3)), std::logic_error);
+  EXPECT_THROW(array.CreateProducer(), std::logic_error);
+  ASSERT_EQ(array.Size(), 603);
+  EXPECT_EQ(array[0], Tagged(0, 0));
+  EXPECT_EQ(array[2], Tagged(0, 2));
+  EXPECT_EQ(array[3], Tagged(1, 0));
+  EXPECT_EQ(array[602], Tagged(1, 599));
+  EXPECT_THROW(array[603], std::out_of_range);
+
+  size_t visited = 0;
+  array.ForEach([&](const Rectangle<int>& figure) { EXPECT_EQ(figure, array[visited++]); });
+  EXPECT_EQ(visited, 603);
+
+  FigureArray<Rectangle<int>> merged = array.Merge();
+  EXPECT_FALSE(array.IsFrozen());
+  EXPECT_EQ(merged[3], Tagged(1, 0));
+  c.PushBack(Tagged(2, 0));
+  EXPECT_EQ(array.Size(), 1);
+}
+
+TEST(ConcurrentFigureArrayTest, UsesMemoryResource) {
+  std::pmr::monotonic_buffer_resource upstream;
+  ConcurrentFigureArray<Rectangle<int>> array(&upstream);
+  auto producer = array.CreateProducer();
+  for (int i = 0; i < 1000; ++i) {
+    producer.PushBack(Tagged(0, i));
+  }
+  FigureArray<Rectangle<int>> merged = array.Merge();
+  EXPECT_EQ(merged.GetResource(), &upstream);
+  EXPECT_EQ(merged.Size(), 1000);
+  EXPECT_THROW(ConcurrentFigureArray<Rectangle<int>>(nullptr), std::invalid_argument);
+}
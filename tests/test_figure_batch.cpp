@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "figure_batch.hpp"
+#include "test_support.hpp"
+
+using namespace geometry;
+using test_support::MakeFigures;
+using test_support::SimdLevelGuard;
+
+namespace {
+
+template <Scalar T, template <typename> class Shape>
+void ExpectMatchesShapes(size_t count) {
+  FigureArray<Shape<T>> figures = MakeFigures<T, Shape>(count);
+  FigureBatch<T, Shape> batch(figures);
+  ASSERT_EQ(batch.Size(), count);
+
+  for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2}) {
+    SimdLevelGuard guard(level);
+    std::vector<double> areas(count);
+    std::vector<double> center_x(count);
+    std::vector<double> center_y(count);
+    batch.ComputeAreas(areas.data());
+    batch.ComputeCenters(center_x.data(), center_y.data());
+
+    double expected_total = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+      double expected = static_cast<double>(figures[i]);
+      expected_total += expected;
+      EXPECT_NEAR(areas[i], expected, 1e-9 * (1.0 + expected));
+      Point<T> center = figures[i].GetCenter();
+      EXPECT_EQ(static_cast<T>(center_x[i]), center.x);
+      EXPECT_EQ(static_cast<T>(center_y[i]), center.y);
+    }
+    EXPECT_NEAR(batch.GetTotalArea(), expected_total, 1e-9 * (1.0 + expected_total));
+  }
+}
+
+}  // namespace
+
+TEST(FigureBatchTest, EmptyBatch) {
+  FigureBatch<double, Rectangle> batch;
+  EXPECT_TRUE(batch.Empty());
+  EXPECT_DOUBLE_EQ(batch.GetTotalArea(), 0.0);
+}
+
+TEST(FigureBatchTest, RoundTripsShapes) {
+  FigureArray<Trapezoid<int>> figures = MakeFigures<int, Trapezoid>(3);
+  FigureBatch<int, Trapezoid> batch(figures);
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    EXPECT_EQ(batch[i], figures[i]);
+  }
+  EXPECT_THROW(batch[3], std::out_of_range);
+  EXPECT_THROW(batch.X(4), std::out_of_range);
+}
+
+TEST(FigureBatchTest, ColumnsAreContiguous) {
+  FigureBatch<double, Rectangle> batch;
+  batch.PushBack(Rectangle<double>(Point<double>(0, 0), Point<double>(4, 0), Point<double>(4, 2),
+                                   Point<double>(0, 2)));
+  batch.PushBack(Rectangle<double>(Point<double>(1, 1), Point<double>(2, 1), Point<double>(2, 3),
+                                   Point<double>(1, 3)));
+  EXPECT_DOUBLE_EQ(batch.X(1)[0], 4.0);
+  EXPECT_DOUBLE_EQ(batch.X(1)[1], 2.0);
+  EXPECT_DOUBLE_EQ(batch.Y(2)[1], 3.0);
+  EXPECT_DOUBLE_EQ(batch.GetTotalArea(), 10.0);
+}
+
+TEST(FigureBatchTest, RectangleKernelsMatchShapes) {
+  ExpectMatchesShapes<double, Rectangle>(37);
+  ExpectMatchesShapes<float, Rectangle>(37);
+  ExpectMatchesShapes<int, Rectangle>(37);
+}
+
+TEST(FigureBatchTest, RhombusKernelsMatchShapes) {
+  ExpectMatchesShapes<double, Rhombus>(37);
+  ExpectMatchesShapes<float, Rhombus>(37);
+  ExpectMatchesShapes<int, Rhombus>(37);
+}
+
+TEST(FigureBatchTest, TrapezoidKernelsMatchShapes) {
+  ExpectMatchesShapes<double, Trapezoid>(37);
+  ExpectMatchesShapes<float, Trapezoid>(37);
+  ExpectMatchesShapes<int, Trapezoid>(37);
+}
+
+TEST(FigureBatchTest, ScalarOnlyTypesUseFallback) {
+  ExpectMatchesShapes<long, Trapezoid>(11);
+  ExpectMatchesShapes<short, Rhombus>(11);
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "figure_collection.hpp"
+
+using namespace geometry;
+
+class FigureCollectionTest : public ::testing::Test {
+ protected:
+  FigureCollection<int> scene;
+
+  void SetUp() override {
+    scene.PushBack(
+        Rhombus<int>(Point<int>(0, 2), Point<int>(2, 0), Point<int>(0, -2), Point<int>(-2, 0)));
+    scene.PushBack(
+        Rectangle<int>(Point<int>(0, 0), Point<int>(4, 0), Point<int>(4, 2), Point<int>(0, 2)));
+    scene.Emplace<Trapezoid<int>>(Point<int>(0, 0), Point<int>(4, 0), Point<int>(3, 2),
+                                  Point<int>(1, 2));
+  }
+};
+
+TEST_F(FigureCollectionTest, SizeCountsAllSegments) {
+  EXPECT_EQ(scene.Size(), 3);
+  EXPECT_EQ(scene.Segment<Rectangle<int>>().Size(), 1);
+  EXPECT_EQ(scene.Segment<Rhombus<int>>().Size(), 1);
+  EXPECT_EQ(scene.Segment<Trapezoid<int>>().Size(), 1);
+  scene.Clear();
+  EXPECT_TRUE(scene.Empty());
+}
+
+TEST_F(FigureCollectionTest, TotalArea) {
+  EXPECT_DOUBLE_EQ(scene.GetTotalArea(), 8.0 + 8.0 + 6.0);
+}
+
+TEST_F(FigureCollectionTest, CentersFollowSegmentOrder) {
+  std::vector<Point<int>> centers = scene.ComputeCenters();
+  ASSERT_EQ(centers.size(), 3);
+  EXPECT_EQ(centers[0], Point<int>(2, 1));
+  EXPECT_EQ(centers[1], Point<int>(0, 0));
+  EXPECT_EQ(centers[2], Point<int>(2, 1));
+}
+
+TEST_F(FigureCollectionTest, ForEachSeesConcreteTypes) {
+  size_t rectangles = 0;
+  size_t others = 0;
+  scene.ForEach([&](const auto& figure) {
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(figure)>, Rectangle<int>>) {
+      ++rectangles;
+    } else {
+      ++others;
+    }
+  });
+  EXPECT_EQ(rectangles, 1);
+  EXPECT_EQ(others, 2);
+}
+
+TEST_F(FigureCollectionTest, PrintAllMatchesArrayFormat) {
+  std::ostringstream out;
+  out << scene;
+  std::string text = out.str();
+  EXPECT_EQ(text.find("Element 0: (0, 0) (4, 0) (4, 2) (0, 2) | Center: (2, 1) | Area: 8\n"), 0);
+  EXPECT_NE(text.find("Element 2: "), std::string::npos);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "figure_file.hpp"
+#include "test_support.hpp"
+
+using namespace geometry;
+using test_support::MakeFigures;
+
+namespace {
+
+std::string TempPath(const std::string& name) {
+  return ::testing::TempDir() + name;
+}
+
+template <Scalar T, template <typename> class Shape>
+void ExpectRoundTrip(size_t count) {
+  FigureArray<Shape<T>> figures = MakeFigures<T, Shape>(count);
+  std::string path = TempPath("figure_file_round_trip.bin");
+  WriteFigureFile(path, figures);
+
+  MappedFigureView<T, Shape> view(path);
+  ASSERT_EQ(view.Size(), count);
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_EQ(view[i], figures[i]);
+  }
+  for (size_t k = 0; k < MappedFigureView<T, Shape>::VERTEX_COUNT; ++k) {
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(view.X(k)) % FigureFileHeader::COLUMN_ALIGNMENT, 0u);
+  }
+  double expected = figures.GetTotalArea();
+  EXPECT_NEAR(view.GetTotalArea(), expected, 1e-9 * (1.0 + expected));
+
+  std::vector<double> areas(count);
+  view.ComputeAreas(areas.data());
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_NEAR(areas[i], static_cast<double>(figures[i]), 1e-9 * (1.0 + areas[i]));
+  }
+  std::remove(path.c_str());
+}
+
+}  // namespace
+
+TEST(FigureFileTest, RoundTripsEveryShapeAndScalar) {
+  ExpectRoundTrip<double, Rectangle>(37);
+  ExpectRoundTrip<float, Rhombus>(100);
+  ExpectRoundTrip<int, Trapezoid>(1000);
+  ExpectRoundTrip<int16_t, Trapezoid>(3);
+}
+
+TEST(FigureFileTest, EmptyArray) {
+  std::string path = TempPath("figure_file_empty.bin");
+  WriteFigureFile(path, FigureArray<Rectangle<double>>());
+  MappedFigureView<double, Rectangle> view(path);
+  EXPECT_TRUE(view.Empty());
+  EXPECT_EQ(view.GetTotalArea(), 0.0);
+  EXPECT_THROW(view[0], std::out_of_range);
+  std::remove(path.c_str());
+}
+
+TEST(FigureFileTest, ViewIsMovable) {
+  std::string path = TempPath("figure_file_move.bin");
+  WriteFigureFile(path, MakeFigures<double, Trapezoid>(10));
+  MappedFigureView<double, Trapezoid> first(path);
+  MappedFigureView<double, Trapezoid> second(std::move(first));
+  EXPECT_EQ(first.Size(), 0);
+  EXPECT_EQ(second.Size(), 10);
+
+  MappedFigureView<double, Trapezoid> third(path);
+  third = std::move(second);
+  EXPECT_EQ(third.Size(), 10);
+  EXPECT_EQ(third[9], (MakeFigures<double, Trapezoid>(10)[9]));
+  std::remove(path.c_str());
+}
+
+TEST(FigureFileTest, RejectsMismatchedTypes) {
+  std::string path = TempPath("figure_file_types.bin");
+  WriteFigureFile(path, MakeFigures<double, Rectangle>(4));
+  EXPECT_THROW((MappedFigureView<double, Rhombus>(path)), std::runtime_error);
+  EXPECT_THROW((MappedFigureView<float, Rectangle>(path)), std::runtime_error);
+  EXPECT_THROW((MappedFigureView<int64_t, Rectangle>(path)), std::runtime_error);
+  EXPECT_NO_THROW((MappedFigureView<double, Rectangle>(path)));
+  std::remove(path.c_str());
+}
+
+TEST(FigureFileTest, RejectsMissingAndCorruptFiles) {
+  std::string path = TempPath("figure_file_corrupt.bin");
+  std::remove(path.c_str());
+  EXPECT_THROW((MappedFigureView<double, Rectangle>(path)), std::system_error);
+
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << "0 0 1 0 1 1 0 1\n";
+  }
+  EXPECT_THROW((MappedFigureView<double, Rectangle>(path)), std::runtime_error);
+
+  WriteFigureFile(path, MakeFigures<double, Rectangle>(100));
+  std::ifstream in(path, std::ios::binary);
+  std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  in.close();
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() / 2));
+  }
+  EXPECT_THROW((MappedFigureView<double, Rectangle>(path)), std::runtime_error);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+#include "figure_hash.hpp"
+#include "figure_vector.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+namespace {
+
+template <typename Shape, Scalar T>
+Shape MakeShape(const Point<T> (&v)[4], size_t start, bool reversed) {
+  Point<T> p[4];
+  for (size_t j = 0; j < 4; ++j) {
+    p[j] = v[reversed ? (start + 4 - j) % 4 : (start + j) % 4];
+  }
+  return Shape(p[0], p[1], p[2], p[3]);
+}
+
+Trapezoid<double> MakeTrapezoid(double x, double y) {
+  return Trapezoid<double>(Point<double>(x, y), Point<double>(x + 6.0, y),
+                           Point<double>(x + 4.0, y + 2.0), Point<double>(x + 1.0, y + 2.0));
+}
+
+// Shape `i` is a copy of shape i % distinct, listed from a varying start vertex and
+// direction.
+FigureArray<Trapezoid<double>> MakeWithDuplicates(size_t count, size_t distinct) {
+  FigureArray<Trapezoid<double>> arr;
+  for (size_t i = 0; i < count; ++i) {
+    Trapezoid<double> base = MakeTrapezoid(static_cast<double>(i % distinct) * 10.0, 0.5);
+    Point<double> v[4] = {base.GetVertex(0), base.GetVertex(1), base.GetVertex(2),
+                          base.GetVertex(3)};
+    arr.PushBack(MakeShape<Trapezoid<double>>(v, i % 4, (i / 4) % 2 == 1));
+  }
+  return arr;
+}
+
+}  // namespace
+
+TEST(FigureHashTest, CanonicalUnderRotationAndDirection) {
+  Point<double> v[4] = {{0.0, 0.0}, {6.0, 0.0}, {4.0, 2.0}, {1.0, 2.0}};
+  Trapezoid<double> reference = MakeShape<Trapezoid<double>>(v, 0, false);
+  FigureHash<Trapezoid<double>> hash;
+  for (size_t start = 0; start < 4; ++start) {
+    for (bool reversed : {false, true}) {
+      Trapezoid<double> shape = MakeShape<Trapezoid<double>>(v, start, reversed);
+      EXPECT_EQ(Canonicalize(shape), Canonicalize(reference));
+      EXPECT_EQ(hash(shape), hash(reference));
+    }
+  }
+  // Swapping two vertices makes a different (self-intersecting) quadrilateral.
+  Trapezoid<double> swapped(v[0], v[2], v[1], v[3]);
+  EXPECT_NE(Canonicalize(swapped), Canonicalize(reference));
+  EXPECT_NE(hash(swapped), hash(reference));
+}
+
+TEST(FigureHashTest, IntegerCoordinatesAreExact) {
+  Point<int64_t> v[4] = {{-5, 3}, {int64_t{1} << 60, 3}, {7, 9}, {-5, 9}};
+  Rectangle<int64_t> a = MakeShape<Rectangle<int64_t>>(v, 2, true);
+  Rectangle<int64_t> b = MakeShape<Rectangle<int64_t>>(v, 1, false);
+  EXPECT_EQ(FigureHash<Rectangle<int64_t>>()(a), FigureHash<Rectangle<int64_t>>()(b));
+  v[1].x += 1;
+  Rectangle<int64_t> c = MakeShape<Rectangle<int64_t>>(v, 0, false);
+  EXPECT_NE(Canonicalize(a), Canonicalize(c));
+}
+
+TEST(FigureHashTest, PointsQuantizeToGridCells) {
+  PointHash<double> hash;
+  EXPECT_EQ(ToGrid(Point<double>(1.0, 2.0)), ToGrid(Point<double>(1.0 + 1e-10, 2.0 - 1e-10)));
+  EXPECT_EQ(hash(Point<double>(1.0, 2.0)), hash(Point<double>(1.0 + 1e-10, 2.0 - 1e-10)));
+  EXPECT_NE(ToGrid(Point<double>(1.0, 2.0)), ToGrid(Point<double>(1.0 + 1e-8, 2.0)));
+  EXPECT_EQ(ToGrid(Point<double>(-0.0, 0.0)), ToGrid(Point<double>(0.0, -1e-12)));
+
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_EQ(ToGrid(Point<double>(nan, 1.0)), ToGrid(Point<double>(-nan, 1.0)));
+
+  // Distinct coordinates whose quotient by the cell overflows stay distinct.
+  EXPECT_NE(ToGrid(Point<double>(1e300, 0.0)), ToGrid(Point<double>(2e300, 0.0)));
+  EXPECT_NE(ToGrid(Point<double>(0.0, -1e300)), ToGrid(Point<double>(0.0, -2e300)));
+  EXPECT_EQ(ToGrid(Point<double>(1e300, 0.0)), ToGrid(Point<double>(1e300, 0.0)));
+
+  // A coarser grid merges more.
+  EXPECT_EQ(ToGrid(Point<double>(1.0, 2.0), 0.1), ToGrid(Point<double>(1.04, 1.96), 0.1));
+  EXPECT_EQ(ToGrid(Point<float>(1.5f, 2.5f)), ToGrid(Point<double>(1.5, 2.5)));
+
+  std::unordered_set<Point<double>, PointHash<double>> points;
+  points.insert(Point<double>(3.0, 4.0));
+  EXPECT_EQ(points.count(Point<double>(3.0, 4.0)), 1u);
+}
+
+TEST(FigureHashTest, DeduplicateKeepsFirstOccurrences) {
+  FigureArray<Trapezoid<double>> arr = MakeWithDuplicates(1000, 37);
+  double area = arr.GetTotalArea();
+  std::vector<Trapezoid<double>> firsts;
+  for (size_t i = 0; i < 37; ++i) {
+    firsts.push_back(arr[i]);
+  }
+
+  EXPECT_EQ(arr.Deduplicate(), 1000u - 37u);
+  ASSERT_EQ(arr.Size(), 37u);
+  for (size_t i = 0; i < 37; ++i) {
+    EXPECT_EQ(arr[i], firsts[i]);
+  }
+  EXPECT_NEAR(arr.GetTotalArea(), area * 37.0 / 1000.0, 1e-9 * area);
+  EXPECT_EQ(arr.Deduplicate(), 0u);
+}
+
+TEST(FigureHashTest, DeduplicateUsesGridCells) {
+  FigureArray<Rhombus<double>> arr;
+  Rhombus<double> rhombus(Point<double>(0.0, 1.0), Point<double>(1.0, 0.0),
+                          Point<double>(0.0, -1.0), Point<double>(-1.0, 0.0));
+  arr.PushBack(rhombus);
+  rhombus.Translate(1e-11, 0.0);
+  arr.PushBack(rhombus);  // same grid cells
+  rhombus.Translate(0.25, 0.0);
+  arr.PushBack(rhombus);  // different at the default cell, equal at cell 1
+  EXPECT_EQ(arr.Deduplicate(), 1u);
+  EXPECT_EQ(arr.Size(), 2u);
+  EXPECT_EQ(arr.Deduplicate(1.0), 1u);
+  EXPECT_EQ(arr.Size(), 1u);
+  EXPECT_THROW(arr.Deduplicate(0.0), std::invalid_argument);
+  EXPECT_THROW(arr.Deduplicate(std::nan("")), std::invalid_argument);
+}
+
+TEST(FigureHashTest, DeduplicateKeepsDistinctHugeShapes) {
+  FigureArray<Rectangle<double>> arr;
+  for (double width : {1e300, 2e300, 1e300}) {
+    arr.PushBack(Rectangle<double>(Point<double>(1e300, 0.0), Point<double>(1e300 + width, 0.0),
+                                   Point<double>(1e300 + width, 1.0), Point<double>(1e300, 1.0)));
+  }
+  EXPECT_EQ(arr.Deduplicate(), 1u);
+  EXPECT_EQ(arr.Size(), 2u);
+}
+
+TEST(FigureHashTest, OverflowedCoordinatesNeverMatchGridCells) {
+  // 1e291 snaps to the cell numbered `huge`, while `huge` itself is too large to divide by
+  // the cell and is kept as is: the same number in two different key spaces.
+  double huge = std::nearbyint(1e291 / DEFAULT_GRID_CELL);
+  ASSERT_TRUE(std::isinf(huge / DEFAULT_GRID_CELL));
+  EXPECT_NE(ToGrid(Point<double>(huge, 0.0)), ToGrid(Point<double>(1e291, 0.0)));
+  EXPECT_NE(ToGrid(Point<double>(0.0, -huge)), ToGrid(Point<double>(0.0, -1e291)));
+  EXPECT_NE(PointHash<double>()(Point<double>(huge, 0.0)),
+            PointHash<double>()(Point<double>(1e291, 0.0)));
+
+  FigureArray<Rectangle<double>> arr;
+  for (double width : {huge, 1e291, huge, 1e291}) {
+    arr.PushBack(Rectangle<double>(Point<double>(0.0, 0.0), Point<double>(width, 0.0),
+                                   Point<double>(width, 1.0), Point<double>(0.0, 1.0)));
+  }
+  EXPECT_EQ(arr.Deduplicate(), 2u);
+  ASSERT_EQ(arr.Size(), 2u);
+  EXPECT_EQ(arr[0].GetVertex(1).x, huge);
+  EXPECT_EQ(arr[1].GetVertex(1).x, 1e291);
+  ThreadPool pool(2);
+  EXPECT_EQ(arr.Deduplicate(pool), 0u);
+}
+
+TEST(FigureHashTest, ParallelDeduplicateMatchesSerial) {
+  ThreadPool pool(4);
+  for (size_t count : {0, 1, 2, 5000, 70000}) {
+    for (size_t distinct : {1, 3, 4999, 100000}) {
+      FigureArray<Trapezoid<double>> serial = MakeWithDuplicates(count, distinct);
+      FigureArray<Trapezoid<double>> parallel = MakeWithDuplicates(count, distinct);
+      size_t removed = serial.Deduplicate();
+      EXPECT_EQ(parallel.Deduplicate(pool), removed) << count << " " << distinct;
+      EXPECT_TRUE(serial == parallel) << count << " " << distinct;
+      EXPECT_EQ(serial.Size(), std::min(count, distinct));
+    }
+  }
+}
+
+TEST(FigureHashTest, DeduplicateMatchesPairwiseOnRandomShapes) {
+  std::mt19937 rng(3);
+  std::uniform_int_distribution<int> coordinate(0, 2);
+  FigureArray<Trapezoid<int>> arr;
+  for (size_t i = 0; i < 400; ++i) {
+    Point<int> p[4];
+    for (Point<int>& point : p) {
+      point = Point<int>(coordinate(rng), coordinate(rng));
+    }
+    arr.PushBack(Trapezoid<int>(p[0], p[1], p[2], p[3]));
+  }
+
+  // Pairwise reference: an element is kept if no earlier element is the same cycle.
+  std::vector<Trapezoid<int>> expected;
+  for (size_t i = 0; i < arr.Size(); ++i) {
+    bool seen = false;
+    for (const Trapezoid<int>& kept : expected) {
+      for (size_t start = 0; start < 4 && !seen; ++start) {
+        for (bool reversed : {false, true}) {
+          bool same = true;
+          for (size_t j = 0; j < 4; ++j) {
+            size_t k = reversed ? (start + 4 - j) % 4 : (start + j) % 4;
+            same = same && arr[i].GetVertex(j) == kept.GetVertex(k);
+          }
+          seen = seen || same;
+        }
+      }
+    }
+    if (!seen) {
+      expected.push_back(arr[i]);
+    }
+  }
+
+  arr.Deduplicate();
+  ASSERT_EQ(arr.Size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(arr[i], expected[i]);
+  }
+}
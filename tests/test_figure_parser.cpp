@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "figure_parser.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+namespace {
+
+const char* const TRAPEZOIDS =
+    "0 0 4 0 3 2 1 2\n"
+    "  +1\t1 5 1\n4 3 2 3\r\n"
+    "-2 -2 2 -2 1 0 -1 0";
+
+template <typename Shape>
+FigureArray<Shape> ReadWithStreams(const std::string& text) {
+  FigureArray<Shape> arr;
+  std::istringstream in(text);
+  Shape shape;
+  while (in >> shape) {
+    arr.PushBack(shape);
+  }
+  return arr;
+}
+
+}  // namespace
+
+TEST(FigureParserTest, MatchesStreamExtraction) {
+  FigureArray<Trapezoid<int>> parsed;
+  EXPECT_EQ(LoadFigures(TRAPEZOIDS, parsed), 3);
+  EXPECT_EQ(parsed, ReadWithStreams<Trapezoid<int>>(TRAPEZOIDS));
+  EXPECT_DOUBLE_EQ(parsed.GetTotalArea(), 6.0 + 6.0 + 6.0);
+}
+
+TEST(FigureParserTest, FloatingPointCoordinates) {
+  std::string text = "0 1.5 1.5 0 0 -1.5 -1.5 0\n0 1e1 10 0 0 -10 -1E1 0\n";
+  FigureArray<Rhombus<double>> parsed;
+  LoadFigures(text, parsed);
+  ASSERT_EQ(parsed.Size(), 2);
+  EXPECT_EQ(parsed, ReadWithStreams<Rhombus<double>>(text));
+  EXPECT_DOUBLE_EQ(static_cast<double>(parsed[1]), 200.0);
+}
+
+TEST(FigureParserTest, ChunkBoundariesInsideNumbers) {
+  std::string text = "10 20 300 20 300 4000 10 4000\n-7 -7 7 -7 7 7 -7 7";
+  FigureArray<Rectangle<int>> whole;
+  LoadFigures(text, whole);
+
+  FigureArray<Rectangle<int>> chunked;
+  FigureParser<Rectangle<int>> parser(chunked, 1);
+  for (char c : text) {
+    parser.Feed(std::string_view(&c, 1));
+  }
+  parser.Finish();
+  EXPECT_EQ(parser.FiguresParsed(), 2);
+  EXPECT_EQ(chunked, whole);
+}
+
+TEST(FigureParserTest, ReportsLineAndColumn) {
+  FigureArray<Rectangle<int>> arr;
+  try {
+    LoadFigures("0 0 4 0 4 2 0 2\n0 0 4 x1 4 2 0 2\n", arr);
+    FAIL() << "expected ParseError";
+  } catch (const ParseError& e) {
+    EXPECT_EQ(e.Line(), 2);
+    EXPECT_EQ(e.Column(), 7);
+    EXPECT_NE(std::string(e.what()).find("x1"), std::string::npos);
+  }
+  EXPECT_EQ(arr.Size(), 0);
+}
+
+TEST(FigureParserTest, RejectsFractionForIntegers) {
+  FigureArray<Rectangle<int>> arr;
+  EXPECT_THROW(LoadFigures("0 0 4.5 0 4 2 0 2", arr), ParseError);
+  EXPECT_THROW(LoadFigures("0 0 99999999999 0 4 2 0 2", arr), ParseError);
+}
+
+TEST(FigureParserTest, RejectsIncompleteFigure) {
+  FigureArray<Rectangle<int>> arr;
+  try {
+    LoadFigures("0 0 4 0 4 2 0 2\n1 1 2", arr);
+    FAIL() << "expected ParseError";
+  } catch (const ParseError& e) {
+    EXPECT_EQ(e.Line(), 2);
+  }
+}
+
+TEST(FigureParserTest, LoadsFromStreamAndFile) {
+  std::istringstream in(TRAPEZOIDS);
+  FigureArray<Trapezoid<int>> from_stream;
+  EXPECT_EQ(LoadFigures(in, from_stream), 3);
+
+  std::string path = ::testing::TempDir() + "figure_parser_test.txt";
+  {
+    std::ofstream out(path);
+    out << TRAPEZOIDS;
+  }
+  FigureArray<Trapezoid<int>> from_file;
+  EXPECT_EQ(LoadFiguresFromFile(path, from_file), 3);
+  EXPECT_EQ(from_file, from_stream);
+  std::remove(path.c_str());
+
+  EXPECT_THROW(LoadFiguresFromFile(path, from_file), std::runtime_error);
+}
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bounded_queue.hpp"
+#include "figure_pipeline.hpp"
+#include "rectangle.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+namespace {
+
+// Axis-aligned trapezoids with varied areas, in the operator>> text format.
+std::string MakeText(size_t count) {
+  std::ostringstream out;
+  for (size_t i = 0; i < count; ++i) {
+    double s = 0.5 + static_cast<double>(i % 97) * 0.25;
+    double o = static_cast<double>(i % 13);
+    out << o << ' ' << o << ' ' << o + 3 * s << ' ' << o << ' ' << o + 2 * s << ' ' << o + s
+        << ' ' << o + s << ' ' << o + s << '\n';
+  }
+  return out.str();
+}
+
+}  // namespace
+
+TEST(BoundedQueueTest, FifoAndClose) {
+  BoundedQueue<int> queue(2);
+  EXPECT_EQ(queue.Capacity(), 2);
+  EXPECT_TRUE(queue.Push(1));
+  EXPECT_TRUE(queue.Push(2));
+  EXPECT_EQ(queue.Pop(), 1);
+  queue.Close();
+  int rejected = 3;
+  EXPECT_FALSE(queue.Push(std::move(rejected)));
+  EXPECT_EQ(queue.Pop(), 2);
+  EXPECT_EQ(queue.Pop(), std::nullopt);
+  EXPECT_EQ(queue.Pop(), std::nullopt);
+  EXPECT_THROW(BoundedQueue<int>(0), std::invalid_argument);
+}
+
+TEST(BoundedQueueTest, ProducersAndConsumers) {
+  BoundedQueue<int> queue(4);
+  std::atomic<long> sum{0};
+  std::vector<std::thread> consumers;
+  for (int c = 0; c < 3; ++c) {
+    consumers.emplace_back([&] {
+      while (std::optional<int> value = queue.Pop()) {
+        sum.fetch_add(*value);
+      }
+    });
+  }
+  std::vector<std::thread> producers;
+  for (int p = 0; p < 2; ++p) {
+    producers.emplace_back([&, p] {
+      for (int i = 1; i <= 1000; ++i) {
+        queue.Push(i * (p + 1));
+      }
+    });
+  }
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+  queue.Close();
+  for (std::thread& consumer : consumers) {
+    consumer.join();
+  }
+  EXPECT_EQ(sum.load(), 500500 * 3);
+}
+
+TEST(FigurePipelineTest, MatchesMaterializedArray) {
+  std::string text = MakeText(10000);
+  FigureArray<Trapezoid<double>> figures;
+  LoadFigures(text, figures);
+
+  PipelineOptions options;
+  options.batch_size = 256;
+  options.worker_count = 3;
+  options.histogram_bins = 10;
+  options.histogram_min = 0.0;
+  options.histogram_max = 1000.0;
+  AreaStatistics stats = FigurePipeline<Trapezoid<double>>(options).Run(std::string_view(text));
+
+  EXPECT_EQ(stats.count, figures.Size());
+  EXPECT_EQ(stats.rejected, 0);
+  EXPECT_NEAR(stats.total_area, figures.GetTotalArea(), 1e-9 * figures.GetTotalArea());
+  std::vector<double> areas = figures.ComputeAreas();
+  EXPECT_EQ(stats.min_area, *std::min_element(areas.begin(), areas.end()));
+  EXPECT_EQ(stats.max_area, *std::max_element(areas.begin(), areas.end()));
+  EXPECT_DOUBLE_EQ(stats.MeanArea(), stats.total_area / 10000.0);
+  EXPECT_EQ(std::accumulate(stats.histogram.begin(), stats.histogram.end(), size_t{0}), 10000);
+  BoundingBox centers;
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    centers.Expand(figures[i].GetCenter().x, figures[i].GetCenter().y);
+  }
+  EXPECT_EQ(stats.center_bounds, centers);
+
+  std::istringstream in(text);
+  AreaStatistics from_stream = FigurePipeline<Trapezoid<double>>(options).Run(in);
+  EXPECT_EQ(from_stream.count, stats.count);
+  EXPECT_EQ(from_stream.total_area, stats.total_area);
+  EXPECT_EQ(from_stream.histogram, stats.histogram);
+}
+
+TEST(FigurePipelineTest, TotalDoesNotDependOnWorkerCount) {
+  std::string text = MakeText(20000);
+  PipelineOptions options;
+  options.batch_size = 100;
+  options.worker_count = 1;
+  double serial = FigurePipeline<Trapezoid<double>>(options).Run(std::string_view(text)).total_area;
+  options.worker_count = 4;
+  options.queue_capacity = 2;
+  double parallel =
+      FigurePipeline<Trapezoid<double>>(options).Run(std::string_view(text)).total_area;
+  EXPECT_EQ(serial, parallel);
+}
+
+TEST(FigurePipelineTest, BatchesHoldBatchSizeFigures) {
+  // Thousands of figures fit in one read chunk; each must still reach the workers in
+  // batches of batch_size.
+  std::string text = MakeText(10007);
+  PipelineOptions options;
+  options.batch_size = 10;
+  options.worker_count = 2;
+  FigurePipeline<Trapezoid<double>> pipeline(options);
+  std::atomic<size_t> batches{0};
+  std::atomic<size_t> oversized{0};
+  pipeline.AddStage([&](FigureArray<Trapezoid<double>>& figures) {
+    batches.fetch_add(1);
+    if (figures.Size() > 10) {
+      oversized.fetch_add(1);
+    }
+  });
+  std::istringstream in(text);
+  EXPECT_EQ(pipeline.Run(in).count, 10007);
+  EXPECT_EQ(batches.load(), 1001);
+  EXPECT_EQ(pipeline.Run(std::string_view(text)).count, 10007);
+  EXPECT_EQ(batches.load(), 2002);
+  EXPECT_EQ(oversized.load(), 0);
+}
+
+TEST(FigurePipelineTest, ValidateAndTransformStages) {
+  std::string text = MakeText(1000);
+  FigureArray<Trapezoid<double>> figures;
+  LoadFigures(text, figures);
+  size_t large = 0;
+  double large_area = 0.0;
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    if (static_cast<double>(figures[i]) >= 100.0) {
+      ++large;
+      large_area += static_cast<double>(figures[i]);
+    }
+  }
+
+  PipelineOptions options;
+  options.batch_size = 64;
+  options.worker_count = 2;
+  FigurePipeline<Trapezoid<double>> pipeline(options);
+  pipeline.Validate([](const Trapezoid<double>& t) { return static_cast<double>(t) >= 100.0; })
+      .Transform(AffineTransform::Scaling(2.0, 3.0));
+  AreaStatistics stats = pipeline.Run(std::string_view(text));
+  EXPECT_EQ(stats.count, large);
+  EXPECT_EQ(stats.rejected, 1000 - large);
+  EXPECT_NEAR(stats.total_area, 6.0 * large_area, 1e-9 * large_area);
+  EXPECT_GE(stats.min_area, 600.0);
+}
+
+TEST(FigurePipelineTest, EmptyInput) {
+  AreaStatistics stats = FigurePipeline<Rectangle<int>>().Run(std::string_view(""));
+  EXPECT_EQ(stats.count, 0);
+  EXPECT_EQ(stats.total_area, 0.0);
+  EXPECT_EQ(stats.MeanArea(), 0.0);
+  EXPECT_TRUE(stats.center_bounds.IsEmpty());
+}
+
+TEST(FigurePipelineTest, ErrorsStopThePipeline) {
+  PipelineOptions options;
+  options.batch_size = 16;
+  options.queue_capacity = 1;
+  options.worker_count = 2;
+  std::string text = MakeText(5000) + "1 2 x";
+  EXPECT_THROW(FigurePipeline<Trapezoid<double>>(options).Run(std::string_view(text)),
+               ParseError);
+
+  FigurePipeline<Trapezoid<double>> failing(options);
+  std::atomic<int> batches{0};
+  failing.AddStage([&](FigureArray<Trapezoid<double>>&) {
+    if (batches.fetch_add(1) == 3) {
+      throw std::runtime_error("stage failed");
+    }
+  });
+  EXPECT_THROW(failing.Run(std::string_view(MakeText(5000))), std::runtime_error);
+
+  EXPECT_THROW(FigurePipeline<Trapezoid<double>>().RunFile("/nonexistent/figures.txt"),
+               std::runtime_error);
+  options.batch_size = 0;
+  EXPECT_THROW(FigurePipeline<Trapezoid<double>>{options}, std::invalid_argument);
+  options.batch_size = 1;
+  options.histogram_bins = 4;
+  EXPECT_THROW(FigurePipeline<Trapezoid<double>>{options}, std::invalid_argument);
+}
+
+TEST(FigurePipelineTest, MappedFigureFile) {
+  std::string text = MakeText(3000);
+  FigureArray<Trapezoid<double>> figures;
+  LoadFigures(text, figures);
+  std::string path = ::testing::TempDir() + "figure_pipeline.bin";
+  WriteFigureFile(path, figures);
+  {
+    MappedFigureView<double, Trapezoid> view(path);
+    PipelineOptions options;
+    options.batch_size = 500;
+    AreaStatistics mapped = FigurePipeline<Trapezoid<double>>(options).Run(view);
+    AreaStatistics parsed = FigurePipeline<Trapezoid<double>>(options).Run(std::string_view(text));
+    EXPECT_EQ(mapped.count, 3000);
+    EXPECT_EQ(mapped.total_area, parsed.total_area);
+    EXPECT_EQ(mapped.center_bounds, parsed.center_bounds);
+  }
+  std::remove(path.c_str());
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "figure_vector.hpp"
+#include "key_sort.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+
+using namespace geometry;
+
+namespace {
+
+Rectangle<double> MakeRectangle(double x, double w, double h) {
+  return Rectangle<double>(Point<double>(x, 0.0), Point<double>(x + w, 0.0),
+                           Point<double>(x + w, h), Point<double>(x, h));
+}
+
+// Areas repeat every 101 elements and center x is unique, so ties and order are observable.
+FigureArray<Rectangle<double>> MakeRectangles(size_t count) {
+  FigureArray<Rectangle<double>> arr;
+  for (size_t i = 0; i < count; ++i) {
+    double w = 1.0 + static_cast<double>((i * 37) % 101);
+    arr.PushBack(MakeRectangle(static_cast<double>(i) * 200.0, w, 2.0));
+  }
+  return arr;
+}
+
+double Area(const Rectangle<double>& r) {
+  return static_cast<double>(r);
+}
+
+double CenterX(const Rectangle<double>& r) {
+  return r.GetCenter().x;
+}
+
+}  // namespace
+
+TEST(KeySortTest, OrderedBitsPreservesOrder) {
+  double inf = std::numeric_limits<double>::infinity();
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> doubles = {-inf, -1e300, -2.5, -1e-310, 0.0, 1e-310, 3.0, 1e300, inf};
+  for (size_t i = 1; i < doubles.size(); ++i) {
+    EXPECT_LT(sorting::OrderedBits(doubles[i - 1]), sorting::OrderedBits(doubles[i]));
+    EXPECT_GT(sorting::ReverseOrderedBits(doubles[i - 1]),
+              sorting::ReverseOrderedBits(doubles[i]));
+  }
+  EXPECT_EQ(sorting::OrderedBits(-0.0), sorting::OrderedBits(0.0));
+  EXPECT_GT(sorting::OrderedBits(nan), sorting::OrderedBits(inf));
+  EXPECT_EQ(sorting::OrderedBits(-nan), sorting::OrderedBits(nan));
+  EXPECT_GT(sorting::ReverseOrderedBits(nan), sorting::ReverseOrderedBits(-inf));
+  EXPECT_LT(sorting::OrderedBits(-1.5f), sorting::OrderedBits(-1.25f));
+
+  std::vector<int64_t> ints = {std::numeric_limits<int64_t>::min(), -7, 0, 7,
+                               std::numeric_limits<int64_t>::max()};
+  for (size_t i = 1; i < ints.size(); ++i) {
+    EXPECT_LT(sorting::OrderedBits(ints[i - 1]), sorting::OrderedBits(ints[i]));
+  }
+}
+
+TEST(KeySortTest, RadixSortIsStableAndMatchesParallel) {
+  for (size_t size : {0u, 1u, 2u, 65535u, 65536u, 65537u, 200000u}) {
+    std::vector<sorting::SortEntry> items(size);
+    for (size_t i = 0; i < size; ++i) {
+      items[i] = {sorting::OrderedBits(static_cast<double>((i * 7919) % 1000) - 500.0), i};
+    }
+    std::vector<sorting::SortEntry> expected = items;
+    std::sort(expected.begin(), expected.end());
+    std::vector<sorting::SortEntry> parallel = items;
+    sorting::RadixSort(items);
+    EXPECT_EQ(items, expected) << size;
+    ThreadPool pool(3);
+    sorting::RadixSort(parallel, pool);
+    EXPECT_EQ(parallel, expected) << size;
+  }
+}
+
+TEST(FigureSortTest, SortByAreaIsStable) {
+  FigureArray<Rectangle<double>> arr = MakeRectangles(500);
+  double total = arr.GetTotalArea();
+  arr.SortBy(Area);
+  ASSERT_EQ(arr.Size(), 500);
+  for (size_t i = 1; i < arr.Size(); ++i) {
+    double prev = static_cast<double>(arr[i - 1]);
+    double cur = static_cast<double>(arr[i]);
+    ASSERT_LE(prev, cur);
+    if (prev == cur) {
+      ASSERT_LT(CenterX(arr[i - 1]), CenterX(arr[i]));
+    }
+  }
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), total);
+
+  arr.SortBy(CenterX);
+  for (size_t i = 0; i < arr.Size(); ++i) {
+    EXPECT_DOUBLE_EQ(arr[i].GetVertex(0).x, static_cast<double>(i) * 200.0);
+  }
+}
+
+TEST(FigureSortTest, ParallelSortByMatchesSerial) {
+  FigureArray<Rectangle<double>> serial = MakeRectangles(20000);
+  FigureArray<Rectangle<double>> parallel = MakeRectangles(20000);
+  auto descending = [](const Rectangle<double>& r) { return -static_cast<double>(r); };
+  serial.SortBy(descending);
+  ThreadPool pool(4);
+  parallel.SortBy(descending, pool);
+  ASSERT_EQ(parallel.Size(), serial.Size());
+  for (size_t i = 0; i < serial.Size(); ++i) {
+    ASSERT_TRUE(parallel[i] == serial[i]) << i;
+  }
+}
+
+TEST(FigureSortTest, NthElementPartitionsAroundKey) {
+  FigureArray<Rectangle<double>> arr = MakeRectangles(1000);
+  std::vector<double> areas = arr.ComputeAreas();
+  std::sort(areas.begin(), areas.end());
+  ThreadPool pool(2);
+  for (size_t n : {0u, 17u, 500u, 999u}) {
+    arr.NthElement(n, Area);
+    EXPECT_DOUBLE_EQ(static_cast<double>(arr[n]), areas[n]);
+    for (size_t i = 0; i < arr.Size(); ++i) {
+      double area = static_cast<double>(arr[i]);
+      if (i < n) {
+        ASSERT_LE(area, areas[n]);
+      } else {
+        ASSERT_GE(area, areas[n]);
+      }
+    }
+    arr.NthElement(n, CenterX, pool);
+    EXPECT_DOUBLE_EQ(arr[n].GetVertex(0).x, static_cast<double>(n) * 200.0);
+  }
+  EXPECT_THROW(arr.NthElement(1000, Area), std::out_of_range);
+}
+
+TEST(FigureSortTest, TopKMovesLargestToFront) {
+  FigureArray<Rectangle<double>> arr = MakeRectangles(1000);
+  std::vector<double> areas = arr.ComputeAreas();
+  std::sort(areas.begin(), areas.end(), std::greater<>());
+  arr.TopK(25, Area);
+  for (size_t i = 0; i < 25; ++i) {
+    EXPECT_DOUBLE_EQ(static_cast<double>(arr[i]), areas[i]);
+  }
+  ASSERT_EQ(arr.Size(), 1000);
+
+  ThreadPool pool(2);
+  FigureArray<Rectangle<double>> serial = MakeRectangles(10000);
+  FigureArray<Rectangle<double>> parallel = MakeRectangles(10000);
+  serial.TopK(100, CenterX);
+  parallel.TopK(100, CenterX, pool);
+  for (size_t i = 0; i < 100; ++i) {
+    EXPECT_DOUBLE_EQ(parallel[i].GetVertex(0).x, static_cast<double>(9999 - i) * 200.0);
+    EXPECT_TRUE(parallel[i] == serial[i]);
+  }
+
+  arr.TopK(5000, Area);
+  for (size_t i = 0; i < arr.Size(); ++i) {
+    EXPECT_DOUBLE_EQ(static_cast<double>(arr[i]), areas[i]);
+  }
+}
+
+TEST(FigureSortTest, NonTriviallyRelocatableElements) {
+  FigureArray<std::string> arr;
+  for (const char* word : {"pear", "fig", "banana", "kiwi", "apple"}) {
+    arr.PushBack(word);
+  }
+  auto length = [](const std::string& s) { return s.size(); };
+  arr.SortBy(length);
+  std::vector<std::string> sorted;
+  for (size_t i = 0; i < arr.Size(); ++i) {
+    sorted.push_back(arr[i]);
+  }
+  EXPECT_EQ(sorted, (std::vector<std::string>{"fig", "pear", "kiwi", "apple", "banana"}));
+
+  ThreadPool pool(2);
+  arr.TopK(1, length, pool);
+  EXPECT_EQ(arr[0], "banana");
+}
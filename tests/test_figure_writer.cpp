@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include "figure_writer.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+namespace {
+
+FigureArray<Trapezoid<double>> MakeTrapezoids() {
+  FigureArray<Trapezoid<double>> figures;
+  figures.PushBack(Trapezoid<double>(Point<double>(0.0, 0.0), Point<double>(4.0, 0.0),
+                                     Point<double>(3.0, 2.0), Point<double>(1.0, 2.0)));
+  figures.PushBack(Trapezoid<double>(Point<double>(-0.1, 1.0 / 3.0), Point<double>(1e7, 0.0),
+                                     Point<double>(123456.789, 2.5e-5), Point<double>(1.0, 2.0)));
+  return figures;
+}
+
+template <typename Figure>
+std::string Written(const FigureArray<Figure>& figures, OutputFormat format,
+                    unsigned fields = FigureWriter::ALL_FIELDS) {
+  std::ostringstream out;
+  WriteFigures(out, figures, format, fields);
+  return out.str();
+}
+
+}  // namespace
+
+TEST(FigureWriterTest, TextMatchesPrintAll) {
+  FigureArray<Trapezoid<double>> trapezoids = MakeTrapezoids();
+  std::ostringstream expected;
+  trapezoids.PrintAll(expected);
+  EXPECT_EQ(Written(trapezoids, OutputFormat::TEXT), expected.str());
+
+  FigureArray<Rhombus<int>> rhombi;
+  rhombi.PushBack(Rhombus<int>(Point<int>(0, 3), Point<int>(2, 0), Point<int>(0, -3),
+                               Point<int>(-2, 0)));
+  std::ostringstream expected_int;
+  rhombi.PrintAll(expected_int);
+  EXPECT_EQ(Written(rhombi, OutputFormat::TEXT), expected_int.str());
+}
+
+TEST(FigureWriterTest, TextFieldSelection) {
+  FigureArray<Rectangle<int>> rectangles;
+  rectangles.PushBack(Rectangle<int>(Point<int>(0, 0), Point<int>(4, 0), Point<int>(4, 2),
+                                     Point<int>(0, 2)));
+  EXPECT_EQ(Written(rectangles, OutputFormat::TEXT, FigureWriter::AREA), "Element 0: Area: 8\n");
+  EXPECT_EQ(Written(rectangles, OutputFormat::TEXT, FigureWriter::CENTER | FigureWriter::AREA),
+            "Element 0: Center: (2, 1) | Area: 8\n");
+  EXPECT_EQ(Written(rectangles, OutputFormat::TEXT, FigureWriter::VERTICES),
+            "Element 0: (0, 0) (4, 0) (4, 2) (0, 2)\n");
+}
+
+TEST(FigureWriterTest, Csv) {
+  FigureArray<Rectangle<int>> rectangles;
+  rectangles.PushBack(Rectangle<int>(Point<int>(0, 0), Point<int>(4, 0), Point<int>(4, 2),
+                                     Point<int>(0, 2)));
+  rectangles.PushBack(Rectangle<int>(Point<int>(1, 1), Point<int>(2, 1), Point<int>(2, 2),
+                                     Point<int>(1, 2)));
+  EXPECT_EQ(Written(rectangles, OutputFormat::CSV),
+            "index,x1,y1,x2,y2,x3,y3,x4,y4,center_x,center_y,area\n"
+            "0,0,0,4,0,4,2,0,2,2,1,8\n"
+            "1,1,1,2,1,2,2,1,2,1,1,1\n");
+  EXPECT_EQ(Written(rectangles, OutputFormat::CSV, FigureWriter::AREA), "index,area\n0,8\n1,1\n");
+}
+
+TEST(FigureWriterTest, JsonLinesRoundTripsDoubles) {
+  FigureArray<Trapezoid<double>> trapezoids = MakeTrapezoids();
+  std::string json = Written(trapezoids, OutputFormat::JSON_LINES, FigureWriter::VERTICES);
+  EXPECT_EQ(json.substr(0, json.find('\n')),
+            "{\"index\":0,\"vertices\":[[0,0],[4,0],[3,2],[1,2]]}");
+  EXPECT_NE(json.find("[-0.1,0.3333333333333333]"), std::string::npos);
+  EXPECT_NE(json.find("[123456.789,2.5e-05]"), std::string::npos);
+}
+
+TEST(FigureWriterTest, JsonLinesNonFiniteIsNull) {
+  double inf = std::numeric_limits<double>::infinity();
+  FigureArray<Rectangle<double>> rectangles;
+  rectangles.PushBack(Rectangle<double>(Point<double>(0.0, 0.0), Point<double>(inf, 0.0),
+                                        Point<double>(inf, 1.0), Point<double>(0.0, 1.0)));
+  EXPECT_EQ(Written(rectangles, OutputFormat::JSON_LINES, FigureWriter::AREA),
+            "{\"index\":0,\"area\":null}\n");
+}
+
+TEST(FigureWriterTest, SmallBufferFlushesInBlocks) {
+  FigureArray<Trapezoid<double>> trapezoids;
+  for (int i = 0; i < 500; ++i) {
+    trapezoids.PushBack(MakeTrapezoids()[i % 2]);
+  }
+  std::ostringstream expected;
+  trapezoids.PrintAll(expected);
+
+  std::ostringstream out;
+  {
+    FigureWriter writer(out, OutputFormat::TEXT, FigureWriter::ALL_FIELDS, 1);
+    writer.Write(trapezoids);
+  }
+  EXPECT_EQ(out.str(), expected.str());
+}
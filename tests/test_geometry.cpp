@@ -1,7 +1,14 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 #include "figure_vector.hpp"
 #include "point.hpp"
@@ -146,6 +153,85 @@ TEST(RectangleEdgeCases, TallRectangle) {
   EXPECT_DOUBLE_EQ(static_cast<double>(tall), 10.0);
 }
 
+TEST(RectangleEdgeCases, CopyIsIndependent) {
+  Rectangle<int> original{Point<int>(0, 0), Point<int>(4, 0), Point<int>(4, 2), Point<int>(0, 2)};
+  Rectangle<int> copy = original;
+  std::istringstream in("1 1 2 1 2 2 1 2");
+  in >> original;
+  EXPECT_DOUBLE_EQ(static_cast<double>(copy), 8.0);
+  EXPECT_DOUBLE_EQ(static_cast<double>(original), 1.0);
+}
+
+TEST(ShapeLayout, VerticesAreStoredInline) {
+  static_assert(std::is_trivially_copyable_v<Point<double>>);
+  static_assert(std::is_nothrow_copy_constructible_v<Rectangle<double>>);
+  static_assert(std::is_nothrow_copy_constructible_v<Rhombus<double>>);
+  static_assert(std::is_nothrow_copy_constructible_v<Trapezoid<double>>);
+  // vptr, four inline vertices and the cached center, area, perimeter and flags.
+  EXPECT_LE(sizeof(Rectangle<double>),
+            sizeof(void*) + 5 * sizeof(Point<double>) + 3 * sizeof(double));
+}
+
+TEST(RectangleEdgeCases, Perimeter) {
+  Rectangle<int> rect{Point<int>(0, 0), Point<int>(4, 0), Point<int>(4, 2), Point<int>(0, 2)};
+  EXPECT_DOUBLE_EQ(rect.GetPerimeter(), 12.0);
+}
+
+TEST(ShapeCache, SetVertexInvalidatesCachedValues) {
+  Rectangle<int> rect{Point<int>(0, 0), Point<int>(4, 0), Point<int>(4, 2), Point<int>(0, 2)};
+  EXPECT_DOUBLE_EQ(static_cast<double>(rect), 8.0);
+  EXPECT_EQ(rect.GetCenter(), Point<int>(2, 1));
+  EXPECT_DOUBLE_EQ(rect.GetPerimeter(), 12.0);
+
+  rect.SetVertex(1, Point<int>(8, 0));
+  rect.SetVertex(2, Point<int>(8, 2));
+  EXPECT_DOUBLE_EQ(static_cast<double>(rect), 16.0);
+  EXPECT_EQ(rect.GetCenter(), Point<int>(4, 1));
+  EXPECT_DOUBLE_EQ(rect.GetPerimeter(), 20.0);
+  EXPECT_EQ(rect.GetVertex(1), Point<int>(8, 0));
+  EXPECT_THROW(rect.SetVertex(4, Point<int>()), std::out_of_range);
+}
+
+TEST(ShapeCache, StreamInputInvalidatesCachedValues) {
+  Trapezoid<int> trap{Point<int>(0, 0), Point<int>(4, 0), Point<int>(3, 2), Point<int>(1, 2)};
+  EXPECT_DOUBLE_EQ(static_cast<double>(trap), 6.0);
+  std::istringstream in("0 0 8 0 6 4 2 4");
+  in >> trap;
+  EXPECT_DOUBLE_EQ(static_cast<double>(trap), 24.0);
+  EXPECT_EQ(trap.GetCenter(), Point<int>(4, 2));
+}
+
+TEST(ShapeCache, AssignmentReplacesCachedValues) {
+  Rhombus<int> small{Point<int>(0, 1), Point<int>(1, 0), Point<int>(0, -1), Point<int>(-1, 0)};
+  Rhombus<int> large{Point<int>(0, 3), Point<int>(3, 0), Point<int>(0, -3), Point<int>(-3, 0)};
+  EXPECT_DOUBLE_EQ(static_cast<double>(small), 2.0);
+  small = large;
+  EXPECT_DOUBLE_EQ(static_cast<double>(small), 18.0);
+}
+
+TEST(ShapeCache, ConcurrentReadersFillOnce) {
+  const Trapezoid<double> trap{Point<double>(0.0, 0.0), Point<double>(4.0, 0.0),
+                               Point<double>(3.0, 2.0), Point<double>(1.0, 2.0)};
+  std::vector<std::thread> readers;
+  std::vector<int> mismatches(8, 0);
+  for (size_t t = 0; t < mismatches.size(); ++t) {
+    readers.emplace_back([&, t] {
+      for (int i = 0; i < 1000; ++i) {
+        Trapezoid<double> copy = trap;
+        if (static_cast<double>(trap) != 6.0 || trap.GetCenter() != Point<double>(2.0, 1.0) ||
+            static_cast<double>(copy) != 6.0) {
+          ++mismatches[t];
+        }
+      }
+    });
+  }
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(mismatches, std::vector<int>(8, 0));
+  EXPECT_DOUBLE_EQ(trap.GetPerimeter(), 4.0 + 2.0 + 2.0 * std::sqrt(5.0));
+}
+
 class TrapezoidTest : public ::testing::Test {
  protected:
   Trapezoid<int> trap1{Point<int>(0, 0), Point<int>(4, 0), Point<int>(3, 2), Point<int>(1, 2)};
@@ -171,6 +257,115 @@ TEST_F(TrapezoidTest, EqualityOperator) {
   EXPECT_EQ(trap1, trap2);
 }
 
+TEST(ExactAreaTest, TrapezoidIntegerCoordinatesDoNotOverflow) {
+  // The shoelace products exceed INT_MAX here.
+  Trapezoid<int> trapezoid(Point<int>(0, 0), Point<int>(90000, 0), Point<int>(60000, 50000),
+                           Point<int>(30000, 50000));
+  EXPECT_EQ(trapezoid.TwiceArea(), static_cast<Int128>(120000) * 50000);
+  EXPECT_DOUBLE_EQ(static_cast<double>(trapezoid), 3e9);
+
+  Trapezoid<int> clockwise(Point<int>(30000, 50000), Point<int>(60000, 50000),
+                           Point<int>(90000, 0), Point<int>(0, 0));
+  EXPECT_EQ(clockwise.TwiceArea(), trapezoid.TwiceArea());
+}
+
+TEST(ExactAreaTest, MatchesSqrtFormulasOnIntegerShapes) {
+  // Rotated 3-4-5 rectangle with sides 5 and 10.
+  Rectangle<int> rectangle(Point<int>(0, 0), Point<int>(3, 4), Point<int>(-5, 10),
+                           Point<int>(-8, 6));
+  EXPECT_EQ(rectangle.TwiceArea(), 100);
+  EXPECT_DOUBLE_EQ(static_cast<double>(rectangle), 50.0);
+
+  Rhombus<int> rhombus(Point<int>(0, 3), Point<int>(5, 0), Point<int>(0, -3), Point<int>(-5, 0));
+  EXPECT_EQ(rhombus.TwiceArea(), 60);
+  EXPECT_DOUBLE_EQ(static_cast<double>(rhombus), 30.0);
+
+  Rectangle<uint32_t> unsigned_rectangle(Point<uint32_t>(4000000000u, 1), Point<uint32_t>(1, 1),
+                                         Point<uint32_t>(1, 3), Point<uint32_t>(4000000000u, 3));
+  EXPECT_EQ(unsigned_rectangle.TwiceArea(), static_cast<Int128>(3999999999u) * 2 * 2);
+}
+
+TEST(ExactAreaTest, SixtyFourBitCoordinates) {
+  int64_t big = int64_t{1} << 61;
+  Rectangle<int64_t> rectangle(Point<int64_t>(-big, -big), Point<int64_t>(big, -big),
+                               Point<int64_t>(big, big), Point<int64_t>(-big, big));
+  Int128 side = static_cast<Int128>(2) * big;
+  EXPECT_EQ(rectangle.TwiceArea(), 2 * side * side);
+  EXPECT_DOUBLE_EQ(static_cast<double>(rectangle), std::ldexp(1.0, 124));
+
+  // One unit of area on top of a huge one is kept exactly.
+  Trapezoid<int64_t> sliver(Point<int64_t>(0, 0), Point<int64_t>(big, 0),
+                            Point<int64_t>(big, 1), Point<int64_t>(-1, 1));
+  EXPECT_EQ(sliver.TwiceArea(), static_cast<Int128>(2) * big + 1);
+}
+
+TEST(ExactAreaTest, ToDoubleRoundsWideValues) {
+  EXPECT_EQ(ToDouble(0), 0.0);
+  EXPECT_EQ(ToDouble(-42), -42.0);
+  EXPECT_EQ(ToDouble(static_cast<Int128>(1) << 100), std::ldexp(1.0, 100));
+  EXPECT_EQ(ToDouble(-(static_cast<Int128>(3) << 70)), -std::ldexp(3.0, 70));
+}
+
+TEST(ExactAccumulatorTest, SumIsCorrectlyRounded) {
+  ExactAccumulator tenths;
+  for (int i = 0; i < 10; ++i) {
+    tenths.Add(0.1);
+  }
+  EXPECT_EQ(tenths.Sum(), 1.0);
+
+  // A tie rounds to even until a lower bit breaks it.
+  ExactAccumulator tie;
+  tie.Add(1.0);
+  tie.Add(std::ldexp(1.0, -53));
+  EXPECT_EQ(tie.Sum(), 1.0);
+  tie.Add(std::ldexp(1.0, -1074));
+  EXPECT_EQ(tie.Sum(), 1.0 + std::ldexp(1.0, -52));
+
+  ExactAccumulator subnormal;
+  subnormal.Add(std::ldexp(1.0, -1074));
+  subnormal.Add(std::ldexp(3.0, -1074));
+  EXPECT_EQ(subnormal.Sum(), std::ldexp(1.0, -1072));
+  subnormal.Add(-5.0);
+  EXPECT_EQ(subnormal.Sum(), -5.0);
+}
+
+TEST(ExactAccumulatorTest, SubtractUndoesAdd) {
+  ExactAccumulator total;
+  total.Add(1e300);
+  total.Add(1.0);
+  total.Add(1e-300);
+  total.Add(1e300);
+  EXPECT_EQ(total.Sum(), 2e300);
+  total.Subtract(1e300);
+  total.Subtract(1e300);
+  EXPECT_EQ(total.Sum(), 1.0);
+  total.Subtract(1.0);
+  EXPECT_EQ(total.Sum(), 1e-300);
+
+  double max = std::numeric_limits<double>::max();
+  ExactAccumulator overflow;
+  overflow.Add(max);
+  overflow.Add(max);
+  EXPECT_EQ(overflow.Sum(), std::numeric_limits<double>::infinity());
+  overflow.Subtract(max);
+  EXPECT_EQ(overflow.Sum(), max);
+
+  ExactAccumulator special;
+  special.Add(std::numeric_limits<double>::infinity());
+  EXPECT_EQ(special.Sum(), std::numeric_limits<double>::infinity());
+  special.Add(std::nan(""));
+  EXPECT_TRUE(std::isnan(special.Sum()));
+  special.Subtract(std::nan(""));
+  special.Subtract(std::numeric_limits<double>::infinity());
+  EXPECT_EQ(special.Sum(), 0.0);
+
+  ExactAccumulator merged;
+  merged.Add(total);
+  merged.Add(0.3);
+  merged.Subtract(total);
+  EXPECT_EQ(merged.Sum(), 0.3);
+}
+
 class ArrayTest : public ::testing::Test {
  protected:
   FigureArray<Rhombus<int>> arr;
@@ -290,6 +485,272 @@ TEST(ArrayEdgeCases, InsertAtWrongPosition) {
   EXPECT_THROW(arr.Insert(5, Rhombus<int>()), std::out_of_range);
 }
 
+TEST(ArrayEdgeCases, EmplaceConstructsInPlace) {
+  FigureArray<Rhombus<int>> arr;
+  const Rhombus<int>& back =
+      arr.EmplaceBack(Point<int>(0, 1), Point<int>(1, 0), Point<int>(0, -1), Point<int>(-1, 0));
+  EXPECT_DOUBLE_EQ(static_cast<double>(back), 2.0);
+  arr.Emplace(0, Point<int>(0, 2), Point<int>(2, 0), Point<int>(0, -2), Point<int>(-2, 0));
+  ASSERT_EQ(arr.Size(), 2);
+  EXPECT_DOUBLE_EQ(static_cast<double>(arr[0]), 8.0);
+  EXPECT_DOUBLE_EQ(static_cast<double>(arr[1]), 2.0);
+  EXPECT_THROW(arr.Emplace(5), std::out_of_range);
+}
+
+TEST(ArrayEdgeCases, InsertOwnElement) {
+  FigureArray<Rhombus<int>> arr;
+  for (int d = 1; d <= 4; ++d) {
+    arr.PushBack(
+        Rhombus<int>(Point<int>(0, d), Point<int>(d, 0), Point<int>(0, -d), Point<int>(-d, 0)));
+  }
+  ASSERT_EQ(arr.Size(), arr.Capacity());
+  arr.Insert(1, arr[3]);
+  arr.Insert(0, arr[4]);
+  EXPECT_DOUBLE_EQ(static_cast<double>(arr[0]), 32.0);
+  EXPECT_DOUBLE_EQ(static_cast<double>(arr[2]), 32.0);
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 2.0 + 8.0 + 18.0 + 32.0 * 3);
+}
+
+TEST(ArrayEdgeCases, ShrinkToFitAndGrowthFactor) {
+  FigureArray<Rhombus<int>> arr;
+  EXPECT_DOUBLE_EQ(arr.GetGrowthFactor(), 2.0);
+  EXPECT_THROW(arr.SetGrowthFactor(1.0), std::invalid_argument);
+  arr.SetGrowthFactor(1.5);
+  for (int i = 0; i < 5; ++i) {
+    arr.PushBack(Rhombus<int>());
+  }
+  EXPECT_EQ(arr.Capacity(), 6);
+  arr.ShrinkToFit();
+  EXPECT_EQ(arr.Capacity(), 5);
+  arr.Clear();
+  arr.ShrinkToFit();
+  EXPECT_EQ(arr.Capacity(), 0);
+  arr.PushBack(Rhombus<int>());
+  EXPECT_EQ(arr.Size(), 1);
+}
+
+TEST(ArrayEdgeCases, NonTriviallyRelocatableElements) {
+  FigureArray<std::string> arr;
+  for (int i = 0; i < 20; ++i) {
+    arr.PushBack(std::string(40, static_cast<char>('a' + i)));
+  }
+  arr.Insert(3, std::string("inserted"));
+  arr.Erase(0);
+  arr.Insert(19, arr[0]);
+  ASSERT_EQ(arr.Size(), 21);
+  EXPECT_EQ(arr[0], std::string(40, 'b'));
+  EXPECT_EQ(arr[2], "inserted");
+  EXPECT_EQ(arr[19], std::string(40, 'b'));
+  EXPECT_EQ(arr[20], std::string(40, 't'));
+}
+
+TEST(ArrayEdgeCases, RunningTotalArea) {
+  FigureArray<Rhombus<int>> arr;
+  arr.PushBack(
+      Rhombus<int>(Point<int>(0, 1), Point<int>(1, 0), Point<int>(0, -1), Point<int>(-1, 0)));
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 2.0);
+
+  arr.PushBack(
+      Rhombus<int>(Point<int>(0, 2), Point<int>(2, 0), Point<int>(0, -2), Point<int>(-2, 0)));
+  arr.Insert(0, Rhombus<int>(Point<int>(0, 3), Point<int>(3, 0), Point<int>(0, -3),
+                             Point<int>(-3, 0)));
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 28.0);
+
+  arr.Erase(1);
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 26.0);
+
+  arr.Modify(0, [](Rhombus<int>& r) {
+    r.SetVertex(0, Point<int>(0, 1));
+    r.SetVertex(2, Point<int>(0, -1));
+  });
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 14.0);
+  EXPECT_DOUBLE_EQ(static_cast<double>(arr[0]), 6.0);
+
+  arr.Erase(0);
+  arr.Erase(0);
+  EXPECT_EQ(arr.GetTotalArea(), 0.0);
+}
+
+TEST(ArrayEdgeCases, RunningTotalSurvivesCancellation) {
+  FigureArray<double> arr;
+  arr.PushBack(1e18);
+  arr.PushBack(1.0);
+  arr.PushBack(1.0);
+  arr.Erase(0);
+  EXPECT_EQ(arr.GetTotalArea(), 2.0);
+  ThreadPool pool(2);
+  EXPECT_EQ(arr.GetTotalArea(pool), 2.0);
+
+  arr.Insert(0, 1e34);
+  arr.Insert(1, 1e17);
+  arr.RemoveRange(0, 2);
+  EXPECT_EQ(arr.GetTotalArea(), 2.0);
+}
+
+TEST(ArrayEdgeCases, MutableIndexingRefreshesTotal) {
+  FigureArray<Rectangle<int>> arr;
+  for (int i = 1; i <= 3; ++i) {
+    arr.PushBack(
+        Rectangle<int>(Point<int>(0, 0), Point<int>(i, 0), Point<int>(i, 1), Point<int>(0, 1)));
+  }
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 6.0);
+
+  arr[0].SetVertex(1, Point<int>(5, 0));
+  arr[0].SetVertex(2, Point<int>(5, 1));
+  arr[2] = Rectangle<int>(Point<int>(0, 0), Point<int>(2, 0), Point<int>(2, 2), Point<int>(0, 2));
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 11.0);
+
+  // Incremental updates after the refresh build on the recomputed total.
+  arr.Erase(1);
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 9.0);
+
+  FigureArray<int> numbers;
+  numbers.PushBack(4);
+  numbers.PushBack(5);
+  numbers[1] = 7;
+  EXPECT_EQ(numbers.GetTotalArea(), 11.0);
+  const FigureArray<int>& view = numbers;
+  EXPECT_EQ(view[1], 7);
+}
+
+TEST(ArrayEdgeCases, ModifyKeepsTotalWhenFunctionThrows) {
+  FigureArray<Rectangle<int>> arr;
+  arr.PushBack(
+      Rectangle<int>(Point<int>(0, 0), Point<int>(1, 0), Point<int>(1, 1), Point<int>(0, 1)));
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 1.0);
+  EXPECT_THROW(arr.Modify(0,
+                          [](Rectangle<int>& r) {
+                            r.SetVertex(1, Point<int>(10, 0));
+                            r.SetVertex(2, Point<int>(10, 1));
+                            throw std::runtime_error("stop");
+                          }),
+               std::runtime_error);
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 10.0);
+  EXPECT_THROW(arr.Modify(1, [](Rectangle<int>&) {}), std::out_of_range);
+}
+
+TEST(ArrayEdgeCases, EraseIfIsStable) {
+  FigureArray<Rhombus<int>> arr;
+  for (int d = 1; d <= 10; ++d) {
+    arr.PushBack(
+        Rhombus<int>(Point<int>(0, d), Point<int>(d, 0), Point<int>(0, -d), Point<int>(-d, 0)));
+  }
+  size_t removed = arr.EraseIf([](const Rhombus<int>& r) { return r.GetVertex(0).y % 3 == 0; });
+  EXPECT_EQ(removed, 3);
+  ASSERT_EQ(arr.Size(), 7);
+  int expected[] = {1, 2, 4, 5, 7, 8, 10};
+  double total = 0.0;
+  for (size_t i = 0; i < arr.Size(); ++i) {
+    EXPECT_EQ(arr[i].GetVertex(0).y, expected[i]);
+    total += 2.0 * expected[i] * expected[i];
+  }
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), total);
+  EXPECT_EQ(arr.EraseIf([](const Rhombus<int>&) { return false; }), 0);
+  EXPECT_EQ(arr.EraseIf([](const Rhombus<int>&) { return true; }), 7);
+  EXPECT_TRUE(arr.Empty());
+  EXPECT_EQ(arr.GetTotalArea(), 0.0);
+}
+
+TEST(ArrayEdgeCases, EraseIfThrowingPredicateKeepsArrayDense) {
+  FigureArray<std::string> arr;
+  for (int i = 0; i < 6; ++i) {
+    arr.PushBack(std::string(1, static_cast<char>('a' + i)));
+  }
+  auto pred = [](const std::string& s) {
+    if (s == "d") {
+      throw std::runtime_error("predicate failed");
+    }
+    return s == "b";
+  };
+  EXPECT_THROW(arr.EraseIf(pred), std::runtime_error);
+  ASSERT_EQ(arr.Size(), 5);
+  EXPECT_EQ(arr[0], "a");
+  EXPECT_EQ(arr[1], "c");
+  EXPECT_EQ(arr[2], "d");
+  EXPECT_EQ(arr[4], "f");
+}
+
+TEST(ArrayEdgeCases, RemoveRange) {
+  FigureArray<std::string> arr;
+  for (int i = 0; i < 8; ++i) {
+    arr.PushBack(std::string(30, static_cast<char>('a' + i)));
+  }
+  arr.RemoveRange(2, 5);
+  ASSERT_EQ(arr.Size(), 5);
+  EXPECT_EQ(arr[1], std::string(30, 'b'));
+  EXPECT_EQ(arr[2], std::string(30, 'f'));
+  arr.RemoveRange(1, 1);
+  EXPECT_EQ(arr.Size(), 5);
+  EXPECT_THROW(arr.RemoveRange(3, 2), std::out_of_range);
+  EXPECT_THROW(arr.RemoveRange(0, 6), std::out_of_range);
+
+  FigureArray<Rhombus<int>> rhombi;
+  for (int d = 1; d <= 4; ++d) {
+    rhombi.PushBack(
+        Rhombus<int>(Point<int>(0, d), Point<int>(d, 0), Point<int>(0, -d), Point<int>(-d, 0)));
+  }
+  rhombi.RemoveRange(1, 3);
+  ASSERT_EQ(rhombi.Size(), 2);
+  EXPECT_DOUBLE_EQ(static_cast<double>(rhombi[1]), 32.0);
+  EXPECT_DOUBLE_EQ(rhombi.GetTotalArea(), 34.0);
+  rhombi.RemoveRange(0, 2);
+  EXPECT_EQ(rhombi.GetTotalArea(), 0.0);
+}
+
+TEST(ArrayEdgeCases, InsertRange) {
+  std::vector<Rhombus<int>> source;
+  for (int d = 1; d <= 3; ++d) {
+    source.emplace_back(Point<int>(0, d), Point<int>(d, 0), Point<int>(0, -d), Point<int>(-d, 0));
+  }
+  FigureArray<Rhombus<int>> arr;
+  arr.InsertRange(0, source.begin(), source.end());
+  arr.InsertRange(1, source.begin(), source.end());
+  ASSERT_EQ(arr.Size(), 6);
+  int expected[] = {1, 1, 2, 3, 2, 3};
+  for (size_t i = 0; i < arr.Size(); ++i) {
+    EXPECT_EQ(arr[i].GetVertex(0).y, expected[i]);
+  }
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 2.0 * (2.0 + 8.0 + 18.0));
+  EXPECT_THROW(arr.InsertRange(7, source.begin(), source.end()), std::out_of_range);
+
+  // Ranges over the array itself, with and without spare capacity.
+  arr.Reserve(32);
+  arr.InsertRange(0, &arr[3], &arr[3] + 3);
+  arr.ShrinkToFit();
+  arr.InsertRange(9, &arr[0], &arr[0] + 2);
+  int self_expected[] = {3, 2, 3, 1, 1, 2, 3, 2, 3, 3, 2};
+  ASSERT_EQ(arr.Size(), 11);
+  for (size_t i = 0; i < arr.Size(); ++i) {
+    EXPECT_EQ(arr[i].GetVertex(0).y, self_expected[i]);
+  }
+}
+
+TEST(ArrayEdgeCases, AppendMovesEveryElement) {
+  FigureArray<std::string> a;
+  FigureArray<std::string> b;
+  for (int i = 0; i < 5; ++i) {
+    a.PushBack(std::string(30, static_cast<char>('a' + i)));
+    b.PushBack(std::string(30, static_cast<char>('A' + i)));
+  }
+  a.Append(std::move(b));
+  ASSERT_EQ(a.Size(), 10);
+  EXPECT_TRUE(b.Empty());
+  EXPECT_EQ(a[4], std::string(30, 'e'));
+  EXPECT_EQ(a[5], std::string(30, 'A'));
+  b.PushBack("reused");
+  EXPECT_EQ(b[0], "reused");
+
+  FigureArray<Rhombus<int>> x;
+  FigureArray<Rhombus<int>> y;
+  x.PushBack(
+      Rhombus<int>(Point<int>(0, 1), Point<int>(1, 0), Point<int>(0, -1), Point<int>(-1, 0)));
+  y.PushBack(
+      Rhombus<int>(Point<int>(0, 2), Point<int>(2, 0), Point<int>(0, -2), Point<int>(-2, 0)));
+  x.Append(std::move(y));
+  EXPECT_DOUBLE_EQ(x.GetTotalArea(), 10.0);
+  EXPECT_EQ(y.GetTotalArea(), 0.0);
+}
+
 TEST(Integration, MixedFigures) {
   FigureArray<Rhombus<int>> rhombuses;
   rhombuses.PushBack(
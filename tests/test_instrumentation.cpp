@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+
+#include "figure_vector.hpp"
+#include "instrumentation.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+
+using namespace geometry;
+
+// Built into geometry_tests with instrumentation off and into geometry_tests_instrumented
+// with GEOMETRY_INSTRUMENTATION=1.
+
+namespace {
+
+Rectangle<double> MakeRectangle(double d) {
+  return Rectangle<double>(Point<double>(0.0, 0.0), Point<double>(d, 0.0), Point<double>(d, d),
+                           Point<double>(0.0, d));
+}
+
+using Array = FigureArray<Rectangle<double>>;
+
+}  // namespace
+
+TEST(InstrumentationTest, TrackingAddsNoSize) {
+  struct Plain {
+    void* vptr;
+    Point<double> vertices[4];
+    double area;
+    double perimeter;
+    Point<double> center;
+    uint8_t cached;
+  };
+  EXPECT_EQ(sizeof(Rectangle<double>), sizeof(Plain));
+  if (!INSTRUMENTATION_ENABLED) {
+    EXPECT_EQ(sizeof(ScopedTimer), 1u);
+  }
+}
+
+#if GEOMETRY_INSTRUMENTATION
+
+TEST(InstrumentationTest, CountsArrayGrowth) {
+  ResetAllCounters();
+  {
+    Array arr;
+    for (int i = 0; i < 5; ++i) {
+      arr.PushBack(MakeRectangle(i + 1.0));
+    }
+  }
+  CounterSnapshot counters = SnapshotCounters<Array>();
+  // Capacity 4, then 8: two buffers, one of which replaced the first.
+  EXPECT_EQ(counters.allocations, 2u);
+  EXPECT_EQ(counters.allocated_bytes, 12 * sizeof(Rectangle<double>));
+  EXPECT_EQ(counters.deallocations, 2u);
+  EXPECT_EQ(counters.reallocations, 1u);
+  EXPECT_EQ(counters.moves, 4u);
+  EXPECT_EQ(counters.copies, 0u);
+}
+
+TEST(InstrumentationTest, CountsCopiesMovesAndShifts) {
+  Array arr;
+  arr.Reserve(8);
+  Rectangle<double> shape = MakeRectangle(2.0);
+  CounterSnapshot array_before = SnapshotCounters<Array>();
+  CounterSnapshot shape_before = SnapshotCounters<Rectangle<double>>();
+
+  arr.PushBack(shape);             // one copy
+  arr.PushBack(MakeRectangle(3));  // one move
+  arr.Insert(0, shape);            // one copy, shifts two elements
+  arr.Erase(0);                    // shifts two elements back
+
+  CounterSnapshot array = SnapshotCounters<Array>() - array_before;
+  CounterSnapshot shapes = SnapshotCounters<Rectangle<double>>() - shape_before;
+  EXPECT_EQ(array.copies, 2u);
+  EXPECT_EQ(array.moves, 4u);
+  EXPECT_EQ(array.allocations, 0u);
+  EXPECT_EQ(shapes.copies, 2u);
+  EXPECT_GE(shapes.moves, 1u);
+}
+
+TEST(InstrumentationTest, CountsAreaAndCenterCalls) {
+  ResetCounters<Rhombus<int>>();
+  Rhombus<int> rhombus(Point<int>(0, 1), Point<int>(1, 0), Point<int>(0, -1), Point<int>(-1, 0));
+  const Figure<int>& figure = rhombus;
+  static_cast<void>(static_cast<double>(figure));
+  static_cast<void>(static_cast<double>(figure));
+  static_cast<void>(figure.GetCenter());
+
+  CounterSnapshot counters = SnapshotCounters<Rhombus<int>>();
+  EXPECT_EQ(counters.area_calls, 2u);
+  EXPECT_EQ(counters.center_calls, 1u);
+
+  bool listed = false;
+  for (const auto& [name, snapshot] : SnapshotAllCounters()) {
+    if (name == "geometry::Rhombus<int>") {
+      listed = true;
+      EXPECT_EQ(snapshot, counters);
+    }
+  }
+  EXPECT_TRUE(listed);
+
+  ResetAllCounters();
+  EXPECT_EQ(SnapshotCounters<Rhombus<int>>(), CounterSnapshot());
+}
+
+TEST(InstrumentationTest, ScopedTimerAccumulates) {
+  ResetAllTimers();
+  for (int i = 0; i < 3; ++i) {
+    ScopedTimer timer("instrumentation_test");
+  }
+  TimerSnapshot snapshot = SnapshotTimer("instrumentation_test");
+  EXPECT_EQ(snapshot.calls, 3u);
+  EXPECT_GE(snapshot.total.count(), 0);
+  EXPECT_EQ(SnapshotTimer("never_started").calls, 0u);
+
+  ResetAllTimers();
+  EXPECT_EQ(SnapshotTimer("instrumentation_test").calls, 0u);
+}
+
+#else
+
+TEST(InstrumentationTest, DisabledRecordsNothing) {
+  Array arr;
+  for (int i = 0; i < 5; ++i) {
+    arr.PushBack(MakeRectangle(i + 1.0));
+  }
+  static_cast<void>(arr.GetTotalArea());
+  {
+    ScopedTimer timer("instrumentation_test");
+  }
+  EXPECT_EQ(SnapshotCounters<Array>(), CounterSnapshot());
+  EXPECT_EQ(SnapshotCounters<Rectangle<double>>(), CounterSnapshot());
+  EXPECT_EQ(SnapshotTimer("instrumentation_test").calls, 0u);
+  EXPECT_TRUE(SnapshotAllCounters().empty());
+}
+
+#endif  // GEOMETRY_INSTRUMENTATION
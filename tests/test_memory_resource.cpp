@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <set>
+#include <vector>
+
+#include "figure_vector.hpp"
+#include "fixed_block_resource.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+
+using namespace geometry;
+
+namespace {
+
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  size_t allocations = 0;
+  size_t deallocations = 0;
+  size_t live_bytes = 0;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    ++allocations;
+    live_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+    ++deallocations;
+    live_bytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+Rhombus<int> UnitRhombus() {
+  return Rhombus<int>(Point<int>(0, 1), Point<int>(1, 0), Point<int>(0, -1), Point<int>(-1, 0));
+}
+
+}  // namespace
+
+TEST(FigureArrayResourceTest, AllocatesFromResource) {
+  CountingResource counting;
+  {
+    FigureArray<Rhombus<int>> arr(&counting);
+    EXPECT_EQ(arr.GetResource(), &counting);
+    for (int i = 0; i < 10; ++i) {
+      arr.PushBack(UnitRhombus());
+    }
+    EXPECT_EQ(counting.allocations, 3);
+    EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 20.0);
+  }
+  EXPECT_EQ(counting.deallocations, counting.allocations);
+  EXPECT_EQ(counting.live_bytes, 0);
+}
+
+TEST(FigureArrayResourceTest, MoveCarriesResource) {
+  CountingResource counting;
+  FigureArray<Rhombus<int>> arr(&counting);
+  arr.PushBack(UnitRhombus());
+  FigureArray<Rhombus<int>> other;
+  other = std::move(arr);
+  EXPECT_EQ(other.GetResource(), &counting);
+  other.ShrinkToFit();
+  EXPECT_EQ(counting.allocations, 2);
+  EXPECT_EQ(counting.live_bytes, sizeof(Rhombus<int>));
+}
+
+TEST(FigureArrayResourceTest, MonotonicArena) {
+  alignas(std::max_align_t) std::byte buffer[1 << 14];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  FigureArray<Rectangle<double>> arr(&arena);
+  arr.Reserve(100);
+  for (int i = 0; i < 100; ++i) {
+    arr.EmplaceBack(Point<double>(0, 0), Point<double>(2, 0), Point<double>(2, 1),
+                    Point<double>(0, 1));
+  }
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(), 200.0);
+}
+
+TEST(FigureArrayResourceTest, NullResourceRejected) {
+  EXPECT_THROW(FigureArray<Rhombus<int>>(nullptr), std::invalid_argument);
+}
+
+TEST(FixedBlockResourceTest, ReusesFreedBlocks) {
+  CountingResource upstream;
+  FixedBlockResource pool = MakeBlockResourceFor<Point<double>>(4, &upstream);
+  EXPECT_GE(pool.BlockSize(), sizeof(Point<double>));
+
+  std::set<void*> blocks;
+  for (int i = 0; i < 4; ++i) {
+    blocks.insert(pool.allocate(sizeof(Point<double>), alignof(Point<double>)));
+  }
+  EXPECT_EQ(blocks.size(), 4);
+  EXPECT_EQ(pool.ChunkCount(), 1);
+
+  void* first = *blocks.begin();
+  pool.deallocate(first, sizeof(Point<double>), alignof(Point<double>));
+  EXPECT_EQ(pool.allocate(sizeof(Point<double>), alignof(Point<double>)), first);
+  EXPECT_EQ(upstream.allocations, 1);
+
+  void* next = pool.allocate(sizeof(Point<double>), alignof(Point<double>));
+  EXPECT_EQ(blocks.count(next), 0);
+  EXPECT_EQ(pool.ChunkCount(), 2);
+
+  pool.Release();
+  EXPECT_EQ(pool.ChunkCount(), 0);
+  EXPECT_EQ(upstream.live_bytes, 0);
+}
+
+TEST(FixedBlockResourceTest, LargeRequestsGoUpstream) {
+  CountingResource upstream;
+  FixedBlockResource pool(16, 8, 8, &upstream);
+  void* big = pool.allocate(1024, 8);
+  EXPECT_EQ(upstream.allocations, 1);
+  EXPECT_EQ(pool.ChunkCount(), 0);
+  pool.deallocate(big, 1024, 8);
+  EXPECT_EQ(upstream.live_bytes, 0);
+}
+
+TEST(FixedBlockResourceTest, BacksSharedShapes) {
+  CountingResource upstream;
+  {
+    FixedBlockResource pool(256, alignof(std::max_align_t), 64, &upstream);
+    std::pmr::polymorphic_allocator<Rectangle<double>> alloc(&pool);
+    std::vector<std::shared_ptr<Figure<double>>> scene;
+    for (int i = 0; i < 100; ++i) {
+      scene.push_back(std::allocate_shared<Rectangle<double>>(
+          alloc, Point<double>(0, 0), Point<double>(1, 0), Point<double>(1, 1),
+          Point<double>(0, 1)));
+    }
+    double total = 0.0;
+    for (const auto& figure : scene) {
+      total += static_cast<double>(*figure);
+    }
+    EXPECT_DOUBLE_EQ(total, 100.0);
+    EXPECT_EQ(pool.ChunkCount(), 2);
+  }
+  EXPECT_EQ(upstream.live_bytes, 0);
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "figure_vector.hpp"
+#include "rhombus.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+namespace {
+
+FigureArray<Trapezoid<double>> MakeTrapezoids(size_t count) {
+  FigureArray<Trapezoid<double>> arr;
+  for (size_t i = 0; i < count; ++i) {
+    double s = 0.1 + static_cast<double>(i % 97) * 0.37;
+    arr.PushBack(Trapezoid<double>(Point<double>(0, 0), Point<double>(3 * s, 0),
+                                   Point<double>(2 * s, s), Point<double>(s, s)));
+  }
+  return arr;
+}
+
+}  // namespace
+
+TEST(ThreadPoolTest, RunsEveryChunkOnce) {
+  ThreadPool pool(4);
+  EXPECT_EQ(pool.ThreadCount(), 4);
+  std::vector<std::atomic<int>> hits(1000);
+  pool.ParallelFor(hits.size(), [&](size_t chunk) { hits[chunk].fetch_add(1); });
+  for (const auto& hit : hits) {
+    EXPECT_EQ(hit.load(), 1);
+  }
+}
+
+TEST(ThreadPoolTest, PropagatesExceptions) {
+  ThreadPool pool(3);
+  EXPECT_THROW(pool.ParallelFor(10,
+                                [](size_t chunk) {
+                                  if (chunk == 7) {
+                                    throw std::runtime_error("chunk failed");
+                                  }
+                                }),
+               std::runtime_error);
+  size_t runs = 0;
+  pool.ParallelFor(1, [&](size_t) { ++runs; });
+  EXPECT_EQ(runs, 1);
+}
+
+TEST(ParallelArrayTest, EmptyArray) {
+  ThreadPool pool(2);
+  FigureArray<Rhombus<int>> arr;
+  EXPECT_DOUBLE_EQ(arr.GetTotalArea(pool), 0.0);
+  EXPECT_TRUE(arr.ComputeAreas(pool).empty());
+  EXPECT_TRUE(arr.ComputeCenters(pool).empty());
+}
+
+TEST(ParallelArrayTest, TotalAreaIsIndependentOfThreadCount) {
+  FigureArray<Trapezoid<double>> arr = MakeTrapezoids(50000);
+  ThreadPool single(1);
+  double reference = arr.GetTotalArea(single);
+  EXPECT_NEAR(reference, arr.GetTotalArea(), 1e-9 * reference);
+  for (size_t threads : {2, 3, 8}) {
+    ThreadPool pool(threads);
+    EXPECT_EQ(arr.GetTotalArea(pool), reference);
+  }
+}
+
+TEST(ParallelArrayTest, BulkAreasAndCentersMatchElements) {
+  FigureArray<Trapezoid<double>> arr = MakeTrapezoids(9000);
+  ThreadPool pool(4);
+  std::vector<double> areas = arr.ComputeAreas(pool);
+  std::vector<Point<double>> centers = arr.ComputeCenters(pool);
+  ASSERT_EQ(areas.size(), arr.Size());
+  ASSERT_EQ(centers.size(), arr.Size());
+  EXPECT_EQ(areas, arr.ComputeAreas());
+  for (size_t i = 0; i < arr.Size(); ++i) {
+    EXPECT_DOUBLE_EQ(areas[i], static_cast<double>(arr[i]));
+    EXPECT_EQ(centers[i], arr[i].GetCenter());
+  }
+}
+
+TEST(ParallelArrayTest, ConstReadersShareOneTotalRefresh) {
+  FigureArray<Trapezoid<double>> arr = MakeTrapezoids(20000);
+  double before = arr.GetTotalArea();
+  arr[0] = Trapezoid<double>(Point<double>(0, 0), Point<double>(6, 0), Point<double>(4, 2),
+                             Point<double>(2, 2));
+  double expected = before - static_cast<double>(MakeTrapezoids(1)[0]) + 8.0;
+
+  const FigureArray<Trapezoid<double>>& view = arr;
+  std::vector<double> seen(4);
+  std::vector<std::thread> readers;
+  for (size_t t = 0; t < seen.size(); ++t) {
+    readers.emplace_back([&, t] { seen[t] = view.GetTotalArea(); });
+  }
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+  for (double total : seen) {
+    EXPECT_NEAR(total, expected, 1e-9 * expected);
+    EXPECT_EQ(total, seen[0]);
+  }
+}
+
+TEST(ParallelArrayTest, EraseIfMatchesSerial) {
+  FigureArray<Trapezoid<double>> serial = MakeTrapezoids(30000);
+  FigureArray<Trapezoid<double>> parallel = MakeTrapezoids(30000);
+  auto small = [](const Trapezoid<double>& t) { return static_cast<double>(t) < 40.0; };
+  size_t removed = serial.EraseIf(small);
+  ThreadPool pool(4);
+  EXPECT_EQ(parallel.EraseIf(small, pool), removed);
+  ASSERT_EQ(parallel.Size(), serial.Size());
+  for (size_t i = 0; i < serial.Size(); ++i) {
+    ASSERT_TRUE(parallel[i] == serial[i]);
+  }
+  EXPECT_NEAR(parallel.GetTotalArea(), serial.GetTotalArea(), 1e-6 * serial.GetTotalArea());
+
+  auto failing = [](const Trapezoid<double>&) -> bool {
+    throw std::runtime_error("predicate failed");
+  };
+  EXPECT_THROW(parallel.EraseIf(failing, pool), std::runtime_error);
+  EXPECT_EQ(parallel.Size(), serial.Size());
+  EXPECT_EQ(parallel.EraseIf([](const Trapezoid<double>&) { return true; }, pool), serial.Size());
+  EXPECT_TRUE(parallel.Empty());
+}
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "figure_batch.hpp"
+#include "test_support.hpp"
+
+using namespace geometry;
+using test_support::SimdLevelGuard;
+
+namespace {
+
+template <template <typename> class Shape, Scalar T>
+uint8_t Check(T x0, T y0, T x1, T y1, T x2, T y2, T x3, T y3) {
+  return Shape<T>(Point<T>(x0, y0), Point<T>(x1, y1), Point<T>(x2, y2), Point<T>(x3, y3))
+      .Validate();
+}
+
+// Mostly valid shapes of each kind plus every kind of defect, including ones that sit
+// right at the tolerance.
+template <Scalar T, template <typename> class Shape>
+FigureArray<Shape<T>> MakeMixedFigures(size_t count) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> coordinate(-50, 50);
+  std::uniform_int_distribution<int> variant(0, 5);
+  FigureArray<Shape<T>> figures;
+  for (size_t i = 0; i < count; ++i) {
+    double ox = coordinate(rng);
+    double oy = coordinate(rng);
+    double ax = coordinate(rng) / 5 * 5 + 1;
+    double ay = coordinate(rng) / 5 * 5;
+    // b is a rotated by 90 degrees: a square, which is also a rhombus and a trapezoid.
+    double bx = -ay;
+    double by = ax;
+    Point<double> p[4] = {{ox, oy}, {ox + ax, oy + ay}, {ox + ax + bx, oy + ay + by},
+                          {ox + bx, oy + by}};
+    switch (variant(rng)) {
+      case 0:
+        break;
+      case 1:
+        p[2].x += 1.0;  // general quadrilateral
+        break;
+      case 2:
+        std::swap(p[1], p[2]);  // bow tie
+        break;
+      case 3:
+        p[3] = p[0];  // degenerate side
+        break;
+      case 4:
+        p[2] = Point<double>(ox + 2.0 * (ax + bx), oy + 2.0 * (ay + by));  // no parallel sides
+        break;
+      default:
+        p[0].x += 1e-3 * ax;  // barely off
+        break;
+    }
+    figures.PushBack(Shape<T>(
+        Point<T>(static_cast<T>(p[0].x), static_cast<T>(p[0].y)),
+        Point<T>(static_cast<T>(p[1].x), static_cast<T>(p[1].y)),
+        Point<T>(static_cast<T>(p[2].x), static_cast<T>(p[2].y)),
+        Point<T>(static_cast<T>(p[3].x), static_cast<T>(p[3].y))));
+  }
+  return figures;
+}
+
+template <Scalar T, template <typename> class Shape>
+void ExpectBatchMatchesShapes(size_t count) {
+  FigureArray<Shape<T>> figures = MakeMixedFigures<T, Shape>(count);
+  FigureBatch<T, Shape> batch(figures);
+  size_t invalid = 0;
+  for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2}) {
+    SimdLevelGuard guard(level);
+    std::vector<uint8_t> all = ValidateAll(figures);
+    std::vector<uint8_t> batched(count);
+    batch.Validate(batched.data());
+    ASSERT_EQ(all.size(), count);
+    invalid = 0;
+    for (size_t i = 0; i < count; ++i) {
+      uint8_t expected = figures[i].Validate();
+      ASSERT_EQ(all[i], expected) << "figure " << i;
+      ASSERT_EQ(batched[i], expected) << "figure " << i;
+      invalid += expected != 0;
+    }
+  }
+  EXPECT_GT(invalid, 0u);
+  EXPECT_LT(invalid, count);
+}
+
+}  // namespace
+
+TEST(ShapeValidationTest, RectangleChecks) {
+  EXPECT_EQ((Check<Rectangle, double>(0, 0, 4, 0, 4, 3, 0, 3)), 0);
+  EXPECT_EQ((Check<Rectangle, double>(0, 0, 0, 3, 4, 3, 4, 0)), 0);  // clockwise
+  EXPECT_EQ((Check<Rectangle, double>(0, 0, 3, 4, -1, 7, -4, 3)), 0);  // rotated
+  EXPECT_EQ((Check<Rectangle, double>(0, 0, 4, 0, 5, 3, 1, 3)), ShapeDefect::NOT_RIGHT_ANGLED);
+  EXPECT_EQ((Check<Rectangle, double>(0, 0, 4, 0, 4, 3, 0, 4)),
+            ShapeDefect::NOT_PARALLEL | ShapeDefect::NOT_RIGHT_ANGLED);
+  EXPECT_EQ((Check<Rectangle, int>(0, 0, 3, 4, -1, 7, -4, 3)), 0);
+  EXPECT_EQ((Check<Rectangle, float>(0.5f, 0.5f, 4.5f, 0.5f, 4.5f, 3.5f, 0.5f, 3.5f)), 0);
+}
+
+TEST(ShapeValidationTest, RhombusChecks) {
+  EXPECT_EQ((Check<Rhombus, double>(0, 0, 2, 1, 4, 0, 2, -1)), 0);
+  EXPECT_EQ((Check<Rhombus, double>(0, 0, 4, 0, 4, 4, 0, 4)), 0);  // square
+  EXPECT_EQ((Check<Rhombus, double>(0, 0, 4, 0, 5, 3, 1, 3)), ShapeDefect::UNEQUAL_SIDES);
+  EXPECT_EQ((Check<Rhombus, int>(0, 0, 3, 4, 8, 4, 5, 0)), 0);
+}
+
+TEST(ShapeValidationTest, TrapezoidChecks) {
+  EXPECT_EQ((Check<Trapezoid, double>(0, 0, 6, 0, 4, 2, 1, 2)), 0);
+  EXPECT_EQ((Check<Trapezoid, double>(0, 0, 4, 0, 5, 3, 1, 3)), 0);  // parallelogram
+  EXPECT_EQ((Check<Trapezoid, double>(0, 0, 6, 0, 4, 2, 1, 3)), ShapeDefect::NOT_PARALLEL);
+}
+
+TEST(ShapeValidationTest, ConvexityAndDegeneracy) {
+  // Bow tie: both pairs of "opposite" sides cross.
+  EXPECT_EQ((Check<Trapezoid, double>(0, 0, 4, 3, 4, 0, 0, 3)) & ShapeDefect::NOT_CONVEX,
+            ShapeDefect::NOT_CONVEX);
+  // Dart: one reflex corner.
+  EXPECT_EQ((Check<Trapezoid, double>(0, 0, 6, 0, 3, 1, 3, 4)),
+            ShapeDefect::NOT_CONVEX | ShapeDefect::NOT_PARALLEL);
+  // Three collinear vertices.
+  EXPECT_EQ((Check<Trapezoid, double>(0, 0, 2, 0, 4, 0, 1, 3)) & ShapeDefect::NOT_CONVEX,
+            ShapeDefect::NOT_CONVEX);
+  EXPECT_NE((Check<Trapezoid, double>(0, 0, 4, 0, 4, 0, 0, 3)) & ShapeDefect::DEGENERATE, 0);
+  EXPECT_NE((Rectangle<double>().Validate()) & ShapeDefect::DEGENERATE, 0);
+}
+
+TEST(ShapeValidationTest, NonFiniteReportsOnlyThatBit) {
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  double inf = std::numeric_limits<double>::infinity();
+  EXPECT_EQ((Check<Rectangle, double>(0, 0, nan, 0, 4, 3, 0, 3)),
+            ShapeDefect::NON_FINITE);
+  EXPECT_EQ((Check<Rhombus, double>(0, 0, 2, 1, 4, 0, 2, -inf)),
+            ShapeDefect::NON_FINITE);
+}
+
+TEST(ShapeValidationTest, ToleranceIsRelative) {
+  for (double scale : {1e-6, 1.0, 1e9}) {
+    EXPECT_EQ((Check<Rectangle, double>(0, 0, 3 * scale, 4 * scale, -1 * scale, 7 * scale,
+                                -4 * scale, 3 * scale)),
+              0)
+        << scale;
+    // An angle off by 1e-6 radians is far outside Point::EPSILON.
+    EXPECT_EQ((Check<Rectangle, double>(0, 0, 4 * scale, 0, 4 * scale, 3 * scale,
+                                -3e-6 * scale, 3 * scale)) &
+                  ShapeDefect::NOT_RIGHT_ANGLED,
+              ShapeDefect::NOT_RIGHT_ANGLED)
+        << scale;
+  }
+  // Rounding error in a rotated square stays well inside it.
+  Rectangle<double> square(Point<double>(0, 0), Point<double>(1, 0), Point<double>(1, 1),
+                           Point<double>(0, 1));
+  square.Rotate(0.3);
+  EXPECT_EQ(square.Validate(), 0);
+}
+
+TEST(ShapeValidationTest, RotatedFloatShapesAreValid) {
+  FigureArray<Rectangle<float>> rectangles;
+  FigureArray<Rhombus<float>> rhombi;
+  FigureArray<Trapezoid<float>> trapezoids;
+  for (int i = 1; i < 100; ++i) {
+    AffineTransform rotation = AffineTransform::Rotation(0.0631 * i, Point<double>(i, -i));
+    auto make = [&](double x0, double y0, double x1, double y1, double x2, double y2, double x3,
+                    double y3) {
+      Point<double> p[4] = {rotation.Apply(Point<double>(x0, y0)),
+                            rotation.Apply(Point<double>(x1, y1)),
+                            rotation.Apply(Point<double>(x2, y2)),
+                            rotation.Apply(Point<double>(x3, y3))};
+      std::vector<Point<float>> q;
+      for (const Point<double>& point : p) {
+        q.emplace_back(static_cast<float>(point.x), static_cast<float>(point.y));
+      }
+      return q;
+    };
+    double w = 1.0 + 0.37 * i;
+    std::vector<Point<float>> r = make(0, 0, w, 0, w, 3, 0, 3);
+    EXPECT_NO_THROW(rectangles.PushBack(Rectangle<float>(STRICT, r[0], r[1], r[2], r[3])))
+        << DescribeDefects(Rectangle<float>(r[0], r[1], r[2], r[3]).Validate());
+    std::vector<Point<float>> h = make(0, 0, 3, 4, 8, 4, 5, 0);
+    EXPECT_NO_THROW(rhombi.PushBack(Rhombus<float>(STRICT, h[0], h[1], h[2], h[3])));
+    std::vector<Point<float>> t = make(0, 0, w + 4, 0, w + 1, 2, 1, 2);
+    EXPECT_NO_THROW(trapezoids.PushBack(Trapezoid<float>(STRICT, t[0], t[1], t[2], t[3])));
+  }
+  for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::AVX2}) {
+    SimdLevelGuard guard(level);
+    for (uint8_t defects : ValidateAll(rectangles)) {
+      EXPECT_EQ(defects, 0);
+    }
+    for (uint8_t defects : ValidateAll(rhombi)) {
+      EXPECT_EQ(defects, 0);
+    }
+    for (uint8_t defects : ValidateAll(trapezoids)) {
+      EXPECT_EQ(defects, 0);
+    }
+  }
+  // The wider float tolerance still catches a visibly skewed corner.
+  EXPECT_EQ((Check<Rectangle, float>(0, 0, 4, 0, 4, 3, -3e-3f, 3)) &
+                ShapeDefect::NOT_RIGHT_ANGLED,
+            ShapeDefect::NOT_RIGHT_ANGLED);
+}
+
+TEST(ShapeValidationTest, StrictConstructorRejectsInvalidVertices) {
+  EXPECT_NO_THROW(Rectangle<double>(STRICT, Point<double>(0, 0), Point<double>(4, 0),
+                                    Point<double>(4, 3), Point<double>(0, 3)));
+  EXPECT_NO_THROW(Trapezoid<int>(STRICT, Point<int>(0, 0), Point<int>(6, 0), Point<int>(4, 2),
+                                 Point<int>(1, 2)));
+  try {
+    Rhombus<double> rhombus(STRICT, Point<double>(0, 0), Point<double>(4, 0),
+                            Point<double>(5, 3), Point<double>(1, 3));
+    FAIL() << "expected InvalidShapeError";
+  } catch (const InvalidShapeError& error) {
+    EXPECT_EQ(error.Defects(), ShapeDefect::UNEQUAL_SIDES);
+    EXPECT_STREQ(error.what(), "Invalid rhombus: unequal sides");
+  }
+  EXPECT_THROW(Rectangle<double>(STRICT, Point<double>(0, 0), Point<double>(4, 0),
+                                 Point<double>(5, 3), Point<double>(1, 3)),
+               std::invalid_argument);
+}
+
+TEST(ShapeValidationTest, DescribeDefects) {
+  EXPECT_EQ(DescribeDefects(0), "valid");
+  EXPECT_EQ(DescribeDefects(ShapeDefect::NOT_CONVEX | ShapeDefect::DEGENERATE),
+            "degenerate side, not convex");
+}
+
+TEST(ShapeValidationTest, BatchMatchesShapes) {
+  ExpectBatchMatchesShapes<double, Rectangle>(1031);
+  ExpectBatchMatchesShapes<double, Rhombus>(1031);
+  ExpectBatchMatchesShapes<double, Trapezoid>(1031);
+  ExpectBatchMatchesShapes<float, Rectangle>(515);
+  ExpectBatchMatchesShapes<int, Rhombus>(515);
+  ExpectBatchMatchesShapes<int64_t, Trapezoid>(515);
+}
+
+TEST(ShapeValidationTest, BatchHandlesNonFinite) {
+  FigureArray<Rectangle<double>> figures;
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  for (int i = 0; i < 9; ++i) {
+    double x = i == 5 ? nan : 0.0;
+    figures.PushBack(Rectangle<double>(Point<double>(x, 0), Point<double>(4, 0),
+                                       Point<double>(4, 3), Point<double>(0, 3)));
+  }
+  for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::AVX2}) {
+    SimdLevelGuard guard(level);
+    std::vector<uint8_t> defects = ValidateAll(figures);
+    for (int i = 0; i < 9; ++i) {
+      EXPECT_EQ(defects[i], i == 5 ? ShapeDefect::NON_FINITE : 0) << i;
+    }
+  }
+  EXPECT_TRUE(ValidateAll(FigureArray<Rectangle<double>>()).empty());
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "rectangle.hpp"
+#include "spatial_index.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+
+namespace {
+
+Rectangle<double> RandomRectangle(std::mt19937& rng, double extent) {
+  std::uniform_real_distribution<double> position(0.0, extent);
+  std::uniform_real_distribution<double> size(0.1, extent / 20.0);
+  double x = position(rng);
+  double y = position(rng);
+  double w = size(rng);
+  double h = size(rng);
+  return Rectangle<double>(Point<double>(x, y), Point<double>(x + w, y), Point<double>(x + w, y + h),
+                           Point<double>(x, y + h));
+}
+
+template <typename Figure>
+std::vector<size_t> ScanWindow(const FigureArray<Figure>& figures, const BoundingBox& window) {
+  std::vector<size_t> result;
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    if (BoundingBox::Of(figures[i]).Intersects(window)) {
+      result.push_back(i);
+    }
+  }
+  return result;
+}
+
+template <typename Figure>
+std::vector<size_t> ScanNearest(const FigureArray<Figure>& figures, const Point<double>& point,
+                                size_t k) {
+  std::vector<std::pair<double, size_t>> distances;
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    auto center = figures[i].GetCenter();
+    double dx = static_cast<double>(center.x) - point.x;
+    double dy = static_cast<double>(center.y) - point.y;
+    distances.emplace_back(dx * dx + dy * dy, i);
+  }
+  std::sort(distances.begin(), distances.end());
+  std::vector<size_t> result;
+  for (size_t i = 0; i < std::min(k, distances.size()); ++i) {
+    result.push_back(distances[i].second);
+  }
+  return result;
+}
+
+template <typename Figure>
+void ExpectMatchesScan(const GridIndex<Figure>& index, const FigureArray<Figure>& figures,
+                       std::mt19937& rng, double extent) {
+  ASSERT_EQ(index.Size(), figures.Size());
+  std::uniform_real_distribution<double> position(-0.2 * extent, 1.2 * extent);
+  std::uniform_real_distribution<double> size(0.0, extent / 4.0);
+  for (int query = 0; query < 50; ++query) {
+    double x = position(rng);
+    double y = position(rng);
+    BoundingBox window(x, y, x + size(rng), y + size(rng));
+    EXPECT_EQ(index.QueryWindow(window), ScanWindow(figures, window));
+
+    Point<double> point(position(rng), position(rng));
+    for (size_t k : {1, 7, 40}) {
+      EXPECT_EQ(index.Nearest(point, k), ScanNearest(figures, point, k));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(GridIndexTest, MatchesLinearScan) {
+  std::mt19937 rng(7);
+  FigureArray<Rectangle<double>> figures;
+  for (int i = 0; i < 2000; ++i) {
+    figures.PushBack(RandomRectangle(rng, 1000.0));
+  }
+  GridIndex<Rectangle<double>> index(figures);
+  EXPECT_GT(index.GetCellCount(), 100);
+  ExpectMatchesScan(index, figures, rng, 1000.0);
+}
+
+TEST(GridIndexTest, IncrementalInsertAndErase) {
+  std::mt19937 rng(11);
+  FigureArray<Rectangle<double>> figures;
+  GridIndex<Rectangle<double>> index;
+  for (int i = 0; i < 300; ++i) {
+    Rectangle<double> figure = RandomRectangle(rng, 100.0);
+    size_t position = rng() % (figures.Size() + 1);
+    figures.Insert(position, figure);
+    index.Insert(position, figure);
+  }
+  ExpectMatchesScan(index, figures, rng, 100.0);
+
+  // Figures far outside the current grid bounds go to the border cells.
+  Rectangle<double> far_away(Point<double>(500.0, 500.0), Point<double>(501.0, 500.0),
+                             Point<double>(501.0, 501.0), Point<double>(500.0, 501.0));
+  figures.Insert(3, far_away);
+  index.Insert(3, far_away);
+  EXPECT_EQ(index.QueryWindow(BoundingBox(499.0, 499.0, 502.0, 502.0)),
+            std::vector<size_t>{3});
+  EXPECT_EQ(index.Nearest(Point<double>(1000.0, 1000.0), 1), std::vector<size_t>{3});
+
+  for (int i = 0; i < 200; ++i) {
+    size_t position = rng() % figures.Size();
+    figures.Erase(position);
+    index.Erase(position);
+  }
+  ExpectMatchesScan(index, figures, rng, 100.0);
+
+  // Inserts between refits reuse the slots freed by the erases.
+  for (int i = 0; i < 100; ++i) {
+    Rectangle<double> figure = RandomRectangle(rng, 100.0);
+    size_t position = rng() % (figures.Size() + 1);
+    figures.Insert(position, figure);
+    index.Insert(position, figure);
+  }
+  ExpectMatchesScan(index, figures, rng, 100.0);
+  for (size_t i = 0; i < figures.Size(); ++i) {
+    EXPECT_EQ(index.GetBox(i).min_x, BoundingBox::Of(figures[i]).min_x);
+  }
+}
+
+TEST(GridIndexTest, IntegerTrapezoids) {
+  FigureArray<Trapezoid<int>> figures;
+  for (int i = 0; i < 100; ++i) {
+    int x = (i % 10) * 10;
+    int y = (i / 10) * 10;
+    figures.PushBack(Trapezoid<int>(Point<int>(x, y), Point<int>(x + 8, y), Point<int>(x + 6, y + 4),
+                                    Point<int>(x + 2, y + 4)));
+  }
+  GridIndex<Trapezoid<int>> index(figures);
+  EXPECT_EQ(index.QueryWindow(BoundingBox(8.0, 4.0, 10.0, 10.0)),
+            (std::vector<size_t>{0, 1, 10, 11}));
+  EXPECT_EQ(index.Nearest(Point<double>(24.0, 32.0), 1), std::vector<size_t>{32});
+}
+
+TEST(GridIndexTest, EmptyAndDegenerate) {
+  GridIndex<Rectangle<double>> empty;
+  EXPECT_TRUE(empty.QueryWindow(BoundingBox(-1.0, -1.0, 1.0, 1.0)).empty());
+  EXPECT_TRUE(empty.Nearest(Point<double>(0.0, 0.0), 3).empty());
+  EXPECT_THROW(empty.Erase(0), std::out_of_range);
+
+  FigureArray<Rectangle<double>> points;
+  for (int i = 0; i < 10; ++i) {
+    points.PushBack(Rectangle<double>(Point<double>(1.0, 1.0), Point<double>(1.0, 1.0),
+                                      Point<double>(1.0, 1.0), Point<double>(1.0, 1.0)));
+  }
+  GridIndex<Rectangle<double>> index(points);
+  EXPECT_EQ(index.QueryWindow(BoundingBox(1.0, 1.0, 1.0, 1.0)).size(), 10);
+  EXPECT_EQ(index.Nearest(Point<double>(0.0, 0.0), 20).size(), 10);
+  EXPECT_EQ(index.Nearest(Point<double>(0.0, 0.0), 2), (std::vector<size_t>{0, 1}));
+}
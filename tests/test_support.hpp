@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+
+#include "figure_vector.hpp"
+#include "point.hpp"
+#include "simd.hpp"
+
+// Helpers shared by several test files.
+namespace test_support {
+
+// `count` quadrilaterals of a few sizes and offsets; valid coordinates for every scalar type.
+template <geometry::Scalar T, template <typename> class Shape>
+geometry::FigureArray<Shape<T>> MakeFigures(size_t count) {
+  using geometry::Point;
+  geometry::FigureArray<Shape<T>> figures;
+  for (size_t i = 0; i < count; ++i) {
+    T s = static_cast<T>(i % 7 + 1);
+    T o = static_cast<T>(i % 5);
+    figures.PushBack(Shape<T>(Point<T>(o, o), Point<T>(o + s + s, o), Point<T>(o + s, o + s),
+                              Point<T>(o + 1, o + s)));
+  }
+  return figures;
+}
+
+// Forces a SIMD level for the lifetime of the guard.
+class SimdLevelGuard {
+ public:
+  explicit SimdLevelGuard(geometry::SimdLevel level) : saved_(geometry::GetSimdLevel()) {
+    geometry::SetSimdLevel(level);
+  }
+  ~SimdLevelGuard() {
+    geometry::SetSimdLevel(saved_);
+  }
+
+ private:
+  geometry::SimdLevel saved_;
+};
+
+}  // namespace test_support
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "figure_vector.hpp"
+#include "rectangle.hpp"
+#include "rhombus.hpp"
+#include "test_support.hpp"
+#include "trapezoid.hpp"
+
+using namespace geometry;
+using test_support::SimdLevelGuard;
+
+namespace {
+
+template <Scalar T>
+void ExpectKernelsMatchApply() {
+  std::mt19937 rng(17);
+  std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+  std::vector<Point<T>> source;
+  for (int i = 0; i < 37; ++i) {
+    source.emplace_back(static_cast<T>(coordinate(rng)), static_cast<T>(coordinate(rng)));
+  }
+  // Exercise rounding ties for integer coordinates.
+  AffineTransform transform = AffineTransform::Scaling(0.5, -1.5)
+                                  .Then(AffineTransform::Rotation(0.3))
+                                  .Then(AffineTransform::Translation(0.5, -0.5));
+  std::vector<Point<T>> expected;
+  for (const Point<T>& point : source) {
+    expected.push_back(transform.Apply(point));
+  }
+
+  for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2}) {
+    SimdLevelGuard guard(level);
+    std::vector<Point<T>> points = source;
+    TransformPoints(transform, points.data(), points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      EXPECT_EQ(points[i].x, expected[i].x) << "level " << static_cast<int>(level) << " i " << i;
+      EXPECT_EQ(points[i].y, expected[i].y) << "level " << static_cast<int>(level) << " i " << i;
+    }
+
+    // One transformer applied to shape-sized runs, as FigureArray::Transform does.
+    points = source;
+    PointTransformer<T> transformer(transform);
+    for (size_t begin = 0; begin < points.size(); begin += 4) {
+      transformer(points.data() + begin, std::min<size_t>(4, points.size() - begin));
+    }
+    for (size_t i = 0; i < points.size(); ++i) {
+      EXPECT_EQ(points[i], expected[i]) << "level " << static_cast<int>(level) << " i " << i;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(AffineTransformTest, Composition) {
+  Point<double> p = AffineTransform::Rotation(std::numbers::pi / 2).Apply(Point<double>(1.0, 0.0));
+  EXPECT_NEAR(p.x, 0.0, 1e-12);
+  EXPECT_NEAR(p.y, 1.0, 1e-12);
+
+  AffineTransform scale_then_move =
+      AffineTransform::Scaling(2.0, 3.0).Then(AffineTransform::Translation(1.0, 1.0));
+  EXPECT_EQ(scale_then_move.Apply(Point<double>(1.0, 1.0)), Point<double>(3.0, 4.0));
+  EXPECT_DOUBLE_EQ(scale_then_move.Determinant(), 6.0);
+
+  Point<double> pivot(5.0, -2.0);
+  Point<double> fixed = AffineTransform::Rotation(1.0, pivot).Apply(pivot);
+  EXPECT_NEAR(fixed.x, pivot.x, 1e-12);
+  EXPECT_NEAR(fixed.y, pivot.y, 1e-12);
+}
+
+TEST(AffineTransformTest, IntegerRounding) {
+  EXPECT_EQ(RoundCoordinate<int>(2.5), 3);
+  EXPECT_EQ(RoundCoordinate<int>(-2.5), -3);
+  EXPECT_EQ(RoundCoordinate<int>(0.49999999999999994), 0);
+  EXPECT_EQ(RoundCoordinate<int>(std::nan("")), 0);
+  EXPECT_EQ(RoundCoordinate<int>(1e20), std::numeric_limits<int>::max());
+  EXPECT_EQ(RoundCoordinate<int>(-1e20), std::numeric_limits<int>::lowest());
+  EXPECT_EQ(RoundCoordinate<uint8_t>(300.0), 255);
+  EXPECT_EQ(RoundCoordinate<uint8_t>(-1.0), 0);
+  EXPECT_EQ(RoundCoordinate<int64_t>(1e30), std::numeric_limits<int64_t>::max());
+  EXPECT_EQ(RoundCoordinate<float>(0.1), 0.1f);
+}
+
+TEST(AffineTransformTest, KernelsMatchApply) {
+  ExpectKernelsMatchApply<double>();
+  ExpectKernelsMatchApply<float>();
+  ExpectKernelsMatchApply<int32_t>();
+  ExpectKernelsMatchApply<int16_t>();
+}
+
+TEST(AffineTransformTest, Int32KernelSaturates) {
+  for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::AVX2}) {
+    SimdLevelGuard guard(level);
+    std::vector<Point<int32_t>> points = {{2000000000, -2000000000}, {3, -3}};
+    TransformPoints(AffineTransform::Scaling(2.0, 2.0), points.data(), points.size());
+    EXPECT_EQ(points[0], Point<int32_t>(std::numeric_limits<int32_t>::max(),
+                                        std::numeric_limits<int32_t>::lowest()));
+    EXPECT_EQ(points[1], Point<int32_t>(6, -6));
+  }
+}
+
+TEST(ShapeTransformTest, InvalidatesCachedValues) {
+  Rectangle<double> rectangle(Point<double>(0.0, 0.0), Point<double>(4.0, 0.0),
+                              Point<double>(4.0, 2.0), Point<double>(0.0, 2.0));
+  EXPECT_DOUBLE_EQ(static_cast<double>(rectangle), 8.0);
+  EXPECT_EQ(rectangle.GetCenter(), Point<double>(2.0, 1.0));
+  EXPECT_DOUBLE_EQ(rectangle.GetPerimeter(), 12.0);
+
+  rectangle.Scale(2.0, 2.0);
+  rectangle.Translate(1.0, -1.0);
+  EXPECT_DOUBLE_EQ(static_cast<double>(rectangle), 32.0);
+  EXPECT_EQ(rectangle.GetCenter(), Point<double>(5.0, 1.0));
+  EXPECT_DOUBLE_EQ(rectangle.GetPerimeter(), 24.0);
+
+  Rhombus<int> rhombus(Point<int>(0, 2), Point<int>(1, 0), Point<int>(0, -2), Point<int>(-1, 0));
+  rhombus.Rotate(std::numbers::pi / 2);
+  EXPECT_EQ(rhombus.GetVertex(0), Point<int>(-2, 0));
+  EXPECT_EQ(rhombus.GetVertex(1), Point<int>(0, 1));
+  EXPECT_DOUBLE_EQ(static_cast<double>(rhombus), 4.0);
+}
+
+TEST(FigureArrayTransformTest, SerialAndParallelAgree) {
+  FigureArray<Trapezoid<int>> serial;
+  FigureArray<Trapezoid<int>> parallel;
+  for (int i = 0; i < 10000; ++i) {
+    int s = i % 13 + 1;
+    Trapezoid<int> figure(Point<int>(i, 0), Point<int>(i + 3 * s, 0), Point<int>(i + 2 * s, s),
+                          Point<int>(i + s, s));
+    serial.PushBack(figure);
+    parallel.PushBack(figure);
+  }
+  double before = serial.GetTotalArea();
+  EXPECT_DOUBLE_EQ(parallel.GetTotalArea(), before);
+
+  AffineTransform transform =
+      AffineTransform::Scaling(3.0, 3.0).Then(AffineTransform::Translation(-7.0, 2.0));
+  serial.Transform(transform);
+  ThreadPool pool(4);
+  parallel.Transform(transform, pool);
+  EXPECT_EQ(serial, parallel);
+
+  // Scaling by 3 multiplies every area by 9; the running total must not be stale.
+  EXPECT_DOUBLE_EQ(serial.GetTotalArea(), 9.0 * before);
+  EXPECT_DOUBLE_EQ(parallel.GetTotalArea(pool), 9.0 * before);
+  EXPECT_EQ(serial[5].GetCenter(), transform.Apply(Trapezoid<int>(
+      Point<int>(5, 0), Point<int>(23, 0), Point<int>(17, 6), Point<int>(11, 6)).GetCenter()));
+}
+
+TEST(FigureArrayTransformTest, TotalTracksTransformedAreas) {
+  FigureArray<Rectangle<double>> serial;
+  FigureArray<Rectangle<double>> parallel;
+  for (int i = 1; i <= 10000; ++i) {
+    double d = i * 0.25;
+    Rectangle<double> figure(Point<double>(0.0, 0.0), Point<double>(d, 0.0),
+                             Point<double>(d, 2.0), Point<double>(0.0, 2.0));
+    serial.PushBack(figure);
+    parallel.PushBack(figure);
+  }
+  auto exact_total = [](const FigureArray<Rectangle<double>>& arr) {
+    ExactAccumulator total;
+    for (double area : arr.ComputeAreas()) {
+      total.Add(area);
+    }
+    return total.Sum();
+  };
+
+  // Rotated shapes get freshly rounded areas; the total follows them, not the old total.
+  ThreadPool pool(3);
+  for (const AffineTransform& transform :
+       {AffineTransform::Rotation(0.4, Point<double>(3.0, 3.0)),
+        AffineTransform::Translation(-8.0, 1.5), AffineTransform::Scaling(1.5, 1.5)}) {
+    serial.Transform(transform);
+    parallel.Transform(transform, pool);
+    EXPECT_EQ(serial, parallel);
+    EXPECT_EQ(serial.GetTotalArea(), exact_total(serial));
+    EXPECT_EQ(parallel.GetTotalArea(), serial.GetTotalArea());
+  }
+}